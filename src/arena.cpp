@@ -0,0 +1,158 @@
+/* arena.cpp                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Bump allocator implementation.
+*/
+
+#include "reflect.h"
+
+#include <cstdlib>
+
+namespace reflect {
+
+/******************************************************************************/
+/* ARENA                                                                      */
+/******************************************************************************/
+
+Arena::
+Arena(size_t chunkSize) :
+    chunkSize(chunkSize),
+    chunks(nullptr), pos(nullptr), end(nullptr),
+    used_(0), reserved_(0)
+{}
+
+Arena::
+~Arena()
+{
+    while (chunks) {
+        Chunk* next = chunks->next;
+        std::free(chunks);
+        chunks = next;
+    }
+}
+
+void*
+Arena::
+allocateChunk(size_t size, size_t align)
+{
+    size_t header = (sizeof(Chunk) + align - 1) & ~(align - 1);
+    size_t total = header + size;
+
+    // Large allocations get their own chunk so that we don't waste the
+    // remainder of the current one.
+    bool dedicated = size > chunkSize / 4;
+    if (!dedicated) total = std::max<size_t>(total, chunkSize);
+
+    Chunk* chunk = static_cast<Chunk*>(std::malloc(total));
+    if (!chunk) reflectError("unable to allocate arena chunk of %lu", total);
+
+    chunk->size = total;
+    reserved_ += total;
+
+    // Dedicated chunks are kept after the current chunk so that we can keep
+    // bumping into it.
+    if (dedicated && chunks) {
+        chunk->next = chunks->next;
+        chunks->next = chunk;
+    }
+    else {
+        chunk->next = chunks;
+        chunks = chunk;
+    }
+
+    uint8_t* start = reinterpret_cast<uint8_t*>(chunk) + header;
+    if (!dedicated) {
+        pos = start + size;
+        end = reinterpret_cast<uint8_t*>(chunk) + total;
+    }
+
+    return start;
+}
+
+void*
+Arena::
+allocate(size_t size, size_t align)
+{
+    if (align > alignof(std::max_align_t))
+        reflectError("unsupported arena alignment: %lu", align);
+
+    if (!size) size = 1;
+    used_ += size;
+
+    uintptr_t current = reinterpret_cast<uintptr_t>(pos);
+    uintptr_t aligned = (current + align - 1) & ~(uintptr_t(align) - 1);
+
+    if (pos && aligned + size <= reinterpret_cast<uintptr_t>(end)) {
+        pos = reinterpret_cast<uint8_t*>(aligned + size);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    return allocateChunk(size, align);
+}
+
+uint8_t*
+Arena::
+chunkStart(Chunk* chunk)
+{
+    // allocate caps the alignment to max_align_t so this header is always
+    // at least as big as the one used when the chunk was created.
+    size_t align = alignof(std::max_align_t);
+    size_t header = (sizeof(Chunk) + align - 1) & ~(align - 1);
+    return reinterpret_cast<uint8_t*>(chunk) + header;
+}
+
+void
+Arena::
+reset()
+{
+    // Dedicated chunks are never placed at the head of the list when a
+    // regular chunk exists so if we have a position then the head is the
+    // chunk we're currently bumping into.
+    Chunk* keep = pos ? chunks : nullptr;
+
+    while (chunks) {
+        Chunk* next = chunks->next;
+        if (chunks != keep) std::free(chunks);
+        chunks = next;
+    }
+
+    used_ = 0;
+    reserved_ = 0;
+    pos = end = nullptr;
+    if (!keep) return;
+
+    keep->next = nullptr;
+    chunks = keep;
+    reserved_ = keep->size;
+    pos = chunkStart(keep);
+    end = reinterpret_cast<uint8_t*>(keep) + keep->size;
+}
+
+
+/******************************************************************************/
+/* ARENA SCOPE                                                                */
+/******************************************************************************/
+
+namespace { thread_local Arena* currentArena = nullptr; }
+
+ArenaScope::
+ArenaScope(Arena& arena) : prev(currentArena)
+{
+    currentArena = &arena;
+}
+
+ArenaScope::
+~ArenaScope()
+{
+    currentArena = prev;
+}
+
+Arena*
+ArenaScope::
+current()
+{
+    return currentArena;
+}
+
+} // namespace reflect
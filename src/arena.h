@@ -0,0 +1,88 @@
+/* arena.h                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Bump allocator.
+
+   Memory is carved out of large chunks and is only returned when the arena is
+   destroyed or reset. Not thread-safe.
+
+   An arena can also be installed for the current thread through ArenaScope
+   in which case Values that need to box their object will allocate it from
+   the arena instead of the heap. These Values must not outlive the arena or
+   its next reset.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* ARENA                                                                      */
+/******************************************************************************/
+
+struct Arena
+{
+    enum { DefaultChunkSize = 64 * 1024 };
+
+    explicit Arena(size_t chunkSize = DefaultChunkSize);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t size, size_t align = alignof(std::max_align_t));
+
+    // Releases everything that was allocated but keeps the current chunk
+    // around so that it can be reused without going back to the system.
+    void reset();
+
+    // Bytes handed out by allocate.
+    size_t used() const { return used_; }
+
+    // Bytes reserved from the system.
+    size_t reserved() const { return reserved_; }
+
+private:
+
+    struct Chunk
+    {
+        Chunk* next;
+        size_t size;
+    };
+
+    void* allocateChunk(size_t size, size_t align);
+    static uint8_t* chunkStart(Chunk* chunk);
+
+    const size_t chunkSize;
+
+    Chunk* chunks;
+    uint8_t* pos;
+    uint8_t* end;
+
+    size_t used_;
+    size_t reserved_;
+};
+
+
+/******************************************************************************/
+/* ARENA SCOPE                                                                */
+/******************************************************************************/
+
+struct ArenaScope
+{
+    explicit ArenaScope(Arena& arena);
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    // Arena installed for the current thread or nullptr if there are none.
+    static Arena* current();
+
+private:
+    Arena* prev;
+};
+
+} // namespace reflect
@@ -0,0 +1,75 @@
+/* call_site.h                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Cached call site.
+
+   Overload resolution is done on the first call for a given set of argument
+   types and the selected function is kept in one of a few inline cache slots.
+   Subsequent calls with the same argument types only compare the arguments
+   against the slots before dispatching. Once all the slots are taken, new
+   argument types are resolved on every call.
+
+   Slots are filled at most once and can be read without locks so a call site
+   can be shared between threads. Note that the cache assumes that the
+   overloads it resolved against aren't modified afterwards.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* CALL SITE                                                                  */
+/******************************************************************************/
+
+template<typename Fn> struct CallSite;
+
+template<typename Ret, typename... Args>
+struct CallSite<Ret(Args...)>
+{
+    // Calls the function of the given name on the type of the first argument.
+    explicit CallSite(const std::string& name);
+
+    // Calls a fixed set of overloads.
+    explicit CallSite(const Overloads& overloads);
+
+    CallSite(const CallSite&) = delete;
+    CallSite& operator=(const CallSite&) = delete;
+
+    Ret call(Args... args) const;
+    Ret operator() (Args... args) const
+    {
+        return call(std::forward<Args>(args)...);
+    }
+
+    // Number of argument types that were resolved and cached.
+    size_t cached() const;
+
+private:
+
+    enum { Arity = sizeof...(Args), Slots = 4 };
+    enum State { Empty, Filling, Ready };
+
+    typedef std::array<Argument, Arity> Key;
+
+    struct Slot
+    {
+        Slot() : state(Empty), fn(nullptr) {}
+
+        std::atomic<int> state;
+        Key key;
+        const Function* fn;
+    };
+
+    const Function* find(const Key& key) const;
+    void insert(const Key& key, const Function* fn) const;
+    const Overloads& overloads(const Key& key) const;
+
+    Symbol name;
+    const Overloads* fixed;
+    mutable std::array<Slot, Slots> slots;
+};
+
+} // reflect
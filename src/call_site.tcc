@@ -0,0 +1,99 @@
+/* call_site.tcc                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Template implementation of CallSite.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* CALL SITE                                                                  */
+/******************************************************************************/
+
+template<typename Ret, typename... Args>
+CallSite<Ret(Args...)>::
+CallSite(const std::string& name) :
+    name(name), fixed(nullptr)
+{
+    if (Arity == 0) reflectError("call site <%s> requires a receiver", name);
+}
+
+template<typename Ret, typename... Args>
+CallSite<Ret(Args...)>::
+CallSite(const Overloads& overloads) :
+    fixed(&overloads)
+{}
+
+template<typename Ret, typename... Args>
+size_t
+CallSite<Ret(Args...)>::
+cached() const
+{
+    size_t count = 0;
+    for (const auto& slot : slots)
+        if (slot.state.load(std::memory_order_acquire) == Ready) count++;
+    return count;
+}
+
+template<typename Ret, typename... Args>
+const Function*
+CallSite<Ret(Args...)>::
+find(const Key& key) const
+{
+    for (const auto& slot : slots) {
+        int state = slot.state.load(std::memory_order_acquire);
+        if (state == Empty) return nullptr;
+        if (state == Ready && slot.key == key) return slot.fn;
+    }
+    return nullptr;
+}
+
+template<typename Ret, typename... Args>
+void
+CallSite<Ret(Args...)>::
+insert(const Key& key, const Function* fn) const
+{
+    for (auto& slot : slots) {
+        int state = Empty;
+        if (!slot.state.compare_exchange_strong(state, Filling)) {
+            if (state == Ready && slot.key == key) return;
+            continue;
+        }
+
+        slot.key = key;
+        slot.fn = fn;
+        slot.state.store(Ready, std::memory_order_release);
+        return;
+    }
+}
+
+template<typename Ret, typename... Args>
+const Overloads&
+CallSite<Ret(Args...)>::
+overloads(const Key& key) const
+{
+    if (fixed) return *fixed;
+    return key[0].type()->function(name);
+}
+
+template<typename Ret, typename... Args>
+Ret
+CallSite<Ret(Args...)>::
+call(Args... args) const
+{
+    Key key = {{ callArgument(std::forward<Args>(args))... }};
+
+    const Function* fn = find(key);
+    if (!fn) {
+        fn = &overloads(key).template resolve<Ret>(std::forward<Args>(args)...);
+        insert(key, fn);
+    }
+
+    return fn->callUnchecked<Ret>(std::forward<Args>(args)...);
+}
+
+} // reflect
@@ -16,9 +16,9 @@ namespace {
 Value lref(Value &value, const Argument& target)
 {
     if (target.type()->isParentOf(value.type())) {
-        if (target.isConst()) return value;
+        if (target.isConst()) return value.ref();
         if (!value.isConst() && value.refType() == RefType::LValue)
-            return value;
+            return value.ref();
     }
 
     // While this is allowed in C++, we can't return a reference to a value that
@@ -39,7 +39,7 @@ Value rref(Value& value, const Argument& target)
     if (target.type()->isMovable()) {
 
         if (value.type()->isChildOf(target.type()))
-            return value;
+            return value.ref();
 
         if (value.type()->hasConverter(target.type()))
             return value.convert<Value>(target.type());
@@ -83,6 +83,11 @@ bool isCastable(const Value& value, const Argument& target)
     return value.argument().isConvertibleTo(target) != Match::None;
 }
 
+bool isDirectCopy(const Value& value, const Type* target)
+{
+    return value.type()->isChildOf(target);
+}
+
 Value cast(Value& value, const Argument& target)
 {
     switch (target.refType()) {
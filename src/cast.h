@@ -37,6 +37,9 @@ struct TargetRef
 bool isCastable(const Value& value, const Argument& target);
 Value cast(Value& value, const Argument& target);
 
+// True if the value can be copied as is into an object of the target type.
+bool isDirectCopy(const Value& value, const Type* target);
+
 template<typename T, typename Target>
 struct Cast
 {
@@ -59,15 +62,36 @@ struct Cast<Value, Target>
         return reflect::isCastable(value, Argument::make<Target>());
     }
 
-    static TargetRef cast(Value value)
+    static TargetRef cast(const Value& value)
     {
-        Value result = reflect::cast(value, Argument::make<Target>());
-        return ret(result, retLValue(), retRValue(), retCopy());
+        Value ref = value.ref();
+        return cast(ref, retDirect());
     }
 
 
 private:
 
+    typedef std::integral_constant<bool,
+        !std::is_reference<Target>::value &&
+        std::is_copy_constructible<CleanTarget>::value>
+    retDirect;
+
+    // Copies can be made straight out of the value which avoids going through
+    // an intermediate copy made by the reflected copy constructor.
+    static TargetRef cast(Value& value, std::true_type)
+    {
+        if (isDirectCopy(value, reflect::type<CleanTarget>()))
+            return *static_cast<const CleanTarget*>(value.value());
+
+        return cast(value, std::false_type());
+    }
+
+    static TargetRef cast(Value& value, std::false_type)
+    {
+        Value result = reflect::cast(value, Argument::make<Target>());
+        return ret(result, retLValue(), retRValue(), retCopy());
+    }
+
     // This giant mess is required to avoid emitting a copy-constructor or a
     // move-constructor in situations where we don't need em.
 
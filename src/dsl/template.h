@@ -17,10 +17,9 @@ namespace reflect {
 #define reflectTemplateLoader()                 \
     static void loader()                        \
     {                                           \
-        static bool loaded = false;             \
-        if (loaded) return;                     \
-        loaded = true;                          \
-        Registry::add<T_>();                    \
+        static bool loaded =                    \
+            (Registry::add<T_>(), true);        \
+        (void) loaded;                          \
     }
 
 
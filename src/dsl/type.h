@@ -53,8 +53,24 @@ namespace reflect {
     } // namespace reflect
 
 
+// Emits the type's record as constant data which the registry picks up on first
+// use. The anchor makes sure that the shared object registers its records.
+#define reflectTypeRecord(_type_)                                       \
+    namespace reflect {                                                 \
+    namespace {                                                         \
+    reflectUsed reflectSection("reflect_types")                         \
+    const TypeRecord reflectUniqueName(record) =                        \
+        { reflectStringify(_type_), &Reflect<_type_>::reflect };        \
+                                                                        \
+    reflectUsed                                                         \
+    const void* const reflectUniqueName(anchor) =                       \
+        &TypeRecords<>::registrar;                                      \
+    }                                                                   \
+    } // namespace reflect
+
+
 #define reflectTypeImpl(_type_)                 \
-    reflectTypeLoader(_type_)                   \
+    reflectTypeRecord(_type_)                   \
                                                 \
     void                                        \
     ::reflect::Reflect<_type_>::                \
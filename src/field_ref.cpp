@@ -0,0 +1,64 @@
+/* field_ref.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   FieldRef implementation.
+*/
+
+#include "reflect.h"
+
+namespace reflect {
+
+/******************************************************************************/
+/* FIELD REF                                                                  */
+/******************************************************************************/
+
+FieldRef::
+FieldRef(const Type* owner, const std::string& field) :
+    FieldRef(owner, owner->field(field))
+{}
+
+FieldRef::
+FieldRef(const Type* owner, Symbol field) :
+    FieldRef(owner, owner->field(field))
+{}
+
+FieldRef::
+FieldRef(const Type* owner, const Field& field) :
+    owner_(owner),
+    type_(field.type()),
+    offset_(field.offset()),
+    isConst_(field.argument().isConst())
+{}
+
+void
+FieldRef::
+checkChild(ValueRef obj) const
+{
+    if (!obj.type() || !obj.type()->isChildOf(owner_)) {
+        reflectError("<%s> is not a child of <%s>",
+                obj.isVoid() ? "void" : obj.typeId(), owner_->id());
+    }
+}
+
+void
+FieldRef::
+checkMutable(ValueRef obj) const
+{
+    if (!isConst_ && !obj.isConst()) return;
+
+    reflectError("field of type <%s> in <%s> is const",
+            type_->id(), owner_->id());
+}
+
+ValueRef
+FieldRef::
+ref(ValueRef obj) const
+{
+    checkObject(obj);
+
+    bool isConst = isConst_ || obj.isConst();
+    return ValueRef(Argument(type_, RefType::LValue, isConst), field(obj));
+}
+
+} // reflect
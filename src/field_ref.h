@@ -0,0 +1,90 @@
+/* field_ref.h                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Precomputed field accessor.
+
+   Resolves the field of a type once so that repeated accesses only need to
+   check the type of the object and add the offset of the field to it. The
+   handle is only as good as the type it was resolved against: fields added to
+   the type afterwards won't be picked up.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* FIELD REF                                                                  */
+/******************************************************************************/
+
+struct FieldRef
+{
+    FieldRef() : owner_(nullptr), type_(nullptr), offset_(0), isConst_(false) {}
+    FieldRef(const Type* owner, const std::string& field);
+    FieldRef(const Type* owner, Symbol field);
+    FieldRef(const Type* owner, const Field& field);
+
+    const Type* owner() const { return owner_; }
+    const Type* type() const { return type_; }
+    size_t offset() const { return offset_; }
+    bool isConst() const { return isConst_; }
+
+    // Reference to the field of obj which can be a reflected object, a Value
+    // or a ValueRef.
+    ValueRef ref(ValueRef obj) const;
+
+    template<typename T, typename Obj>
+    const T& get(const Obj& obj) const;
+
+    // Assigns value to the field of obj. Values of the exact type of the field
+    // are assigned directly while everything else goes through the field's
+    // reflected operator=.
+    template<typename Obj, typename T>
+    void set(Obj&& obj, T&& value) const;
+
+    // Batch versions that walk n objects of the same type laid out stride
+    // bytes apart, starting from first. Only the first object is type checked
+    // and scatter requires T to be the exact type of the field.
+    template<typename T>
+    void gather(ValueRef first, size_t n, size_t stride, T* out) const;
+    template<typename T, typename Obj>
+    void gather(const Obj* objs, size_t n, T* out) const;
+
+    template<typename T>
+    void scatter(ValueRef first, size_t n, size_t stride, const T* in) const;
+    template<typename T, typename Obj>
+    void scatter(Obj* objs, size_t n, const T* in) const;
+
+private:
+
+    void checkObject(ValueRef obj) const
+    {
+        if (obj.type() != owner_) checkChild(obj);
+    }
+
+    void checkChild(ValueRef obj) const;
+    void checkMutable(ValueRef obj) const;
+
+    template<typename T>
+    void checkField() const;
+
+    template<typename T>
+    static bool assign(void* field, T&& value, std::true_type);
+
+    template<typename T>
+    static bool assign(void*, T&&, std::false_type) { return false; }
+
+    void* field(ValueRef obj) const
+    {
+        return static_cast<uint8_t*>(obj.value()) + offset_;
+    }
+
+    const Type* owner_;
+    const Type* type_;
+    size_t offset_;
+    bool isConst_;
+};
+
+} // reflect
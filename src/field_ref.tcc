@@ -0,0 +1,123 @@
+/* field_ref.tcc                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   FieldRef template implementation.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* FIELD REF                                                                  */
+/******************************************************************************/
+
+template<typename T>
+void
+FieldRef::
+checkField() const
+{
+    if (type_ == reflect::type<T>() || type_->isChildOf<T>()) return;
+
+    reflectError("<%s> is not a base of <%s>",
+            type_->id(), reflect::type<T>()->id());
+}
+
+template<typename T>
+bool
+FieldRef::
+assign(void* field, T&& value, std::true_type)
+{
+    typedef typename std::decay<T>::type CleanT;
+    *static_cast<CleanT*>(field) = std::forward<T>(value);
+    return true;
+}
+
+template<typename T, typename Obj>
+const T&
+FieldRef::
+get(const Obj& obj) const
+{
+    ValueRef object(obj);
+    checkObject(object);
+    checkField<T>();
+
+    return *static_cast<const T*>(field(object));
+}
+
+template<typename Obj, typename T>
+void
+FieldRef::
+set(Obj&& obj, T&& value) const
+{
+    typedef typename std::decay<T>::type CleanT;
+    typedef typename std::is_assignable<CleanT&, T&&>::type IsAssignable;
+
+    ValueRef object(obj);
+    checkObject(object);
+    checkMutable(object);
+
+    if (type_ == reflect::type<CleanT>()) {
+        if (assign(field(object), std::forward<T>(value), IsAssignable()))
+            return;
+    }
+
+    ref(object).assign(std::forward<T>(value));
+}
+
+template<typename T>
+void
+FieldRef::
+gather(ValueRef first, size_t n, size_t stride, T* out) const
+{
+    if (!n) return;
+
+    checkObject(first);
+    checkField<T>();
+
+    const uint8_t* it = static_cast<const uint8_t*>(field(first));
+    for (size_t i = 0; i < n; ++i, it += stride)
+        out[i] = *reinterpret_cast<const T*>(it);
+}
+
+template<typename T, typename Obj>
+void
+FieldRef::
+gather(const Obj* objs, size_t n, T* out) const
+{
+    if (!n) return;
+    gather(ValueRef(objs[0]), n, sizeof(Obj), out);
+}
+
+template<typename T>
+void
+FieldRef::
+scatter(ValueRef first, size_t n, size_t stride, const T* in) const
+{
+    if (!n) return;
+
+    checkObject(first);
+    checkMutable(first);
+
+    if (type_ != reflect::type<T>()) {
+        reflectError("<%s> is not the type of field <%s>",
+                reflect::type<T>()->id(), type_->id());
+    }
+
+    uint8_t* it = static_cast<uint8_t*>(field(first));
+    for (size_t i = 0; i < n; ++i, it += stride)
+        *reinterpret_cast<T*>(it) = in[i];
+}
+
+template<typename T, typename Obj>
+void
+FieldRef::
+scatter(Obj* objs, size_t n, const T* in) const
+{
+    if (!n) return;
+    scatter(ValueRef(objs[0]), n, sizeof(Obj), in);
+}
+
+} // reflect
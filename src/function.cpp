@@ -16,10 +16,43 @@ namespace reflect {
 /* FUNCTION                                                                   */
 /******************************************************************************/
 
+Function::
+Function(const Function& other) :
+    fn(retainValueFunction(other.fn)),
+    name_(other.name_),
+    typedId(other.typedId),
+    typedFn(other.typedFn),
+    typedTarget(other.typedTarget),
+    ret(other.ret),
+    args(other.args)
+{}
+
+Function&
+Function::
+operator=(const Function& other)
+{
+    if (this == &other) return *this;
+
+    freeValueFunction(fn);
+    fn = retainValueFunction(other.fn);
+
+    name_ = other.name_;
+    typedId = other.typedId;
+    typedFn = other.typedFn;
+    typedTarget = other.typedTarget;
+    ret = other.ret;
+    args = other.args;
+
+    return *this;
+}
+
 Function::
 Function(Function&& other) noexcept :
     fn(other.fn),
     name_(std::move(other.name_)),
+    typedId(other.typedId),
+    typedFn(other.typedFn),
+    typedTarget(other.typedTarget),
     ret(std::move(other.ret)),
     args(std::move(other.args))
 {
@@ -32,10 +65,14 @@ operator=(Function&& other) noexcept
 {
     if (this == &other) return *this;
 
+    freeValueFunction(fn);
     fn = other.fn;
     other.fn = nullptr;
 
     name_ = std::move(other.name_);
+    typedId = other.typedId;
+    typedFn = other.typedFn;
+    typedTarget = other.typedTarget;
     ret = std::move(other.ret);
     args = std::move(other.args);
 
@@ -88,6 +125,57 @@ testArguments(
     return match;
 }
 
+Match
+Function::
+testArguments(const Argument* value, size_t size) const
+{
+    if (size != args.size()) return Match::None;
+
+    Match match = Match::Exact;
+    for (size_t i = 0; i < size; ++i) {
+        match = combine(match, value[i].isConvertibleTo(args[i]));
+        if (match == Match::None) return Match::None;
+    }
+
+    return match;
+}
+
+Match
+Function::
+testValues(const Value* values, size_t size) const
+{
+    if (size != args.size()) return Match::None;
+
+    Match match = testReturn(Argument::make<Value>(), ret);
+    for (size_t i = 0; i < size && match != Match::None; ++i)
+        match = combine(match, values[i].argument().isConvertibleTo(args[i]));
+
+    return match;
+}
+
+void
+Function::
+invoke(const Value* args, size_t size, Value& ret) const
+{
+    if (testValues(args, size) == Match::None) {
+        std::vector<Argument> params;
+        for (size_t i = 0; i < size; ++i) params.push_back(args[i].argument());
+
+        reflectError("<%s> is not convertible to <%s>",
+                signature(Argument::make<Value>(), params), signature(*this));
+    }
+
+    invokeUnchecked(args, ret);
+}
+
+void
+Function::
+invokeUnchecked(const Value* args, Value& ret) const
+{
+    typedef ValueFunction<0> Fn;
+    static_cast<Fn*>(fn)->invoke(args, ret);
+}
+
 Match
 Function::
 test(const Function& other) const
@@ -97,13 +185,22 @@ test(const Function& other) const
             testArguments(other.args, args));
 }
 
+Match
+Function::
+test(const Argument& ret, const Argument* args, size_t size) const
+{
+    return combine(
+            testReturn(ret, this->ret),
+            testArguments(args, size));
+}
+
 Match
 Function::
 test(const Argument& ret, const std::vector<Argument>& args) const
 {
     return combine(
             testReturn(ret, this->ret),
-            testArguments(args, this->args));
+            testArguments(args.data(), args.size()));
 }
 
 
@@ -20,6 +20,10 @@ template<typename Fn> std::vector<Argument> reflectArguments();
 template<typename... Args>
 std::vector<Argument> reflectArguments(Args&&... args);
 
+// Same as reflectArguments but the arguments are stored inline.
+template<typename Fn> struct ArgumentArray;
+template<typename Fn> typename ArgumentArray<Fn>::type reflectArgumentArray();
+
 
 /******************************************************************************/
 /* FUNCTION                                                                   */
@@ -31,8 +35,9 @@ struct Function
     Function(const std::string& name, Fn fn);
     ~Function();
 
-    Function(const Function&) = delete;
-    Function& operator=(const Function&) = delete;
+    // Copies share the reflected function object.
+    Function(const Function& other);
+    Function& operator=(const Function& other);
     Function(Function&&) noexcept;
     Function& operator=(Function&&) noexcept;
 
@@ -47,6 +52,7 @@ struct Function
     Match test() const;
     Match test(const Function& other) const;
     Match test(const Argument& ret, const std::vector<Argument>& args) const;
+    Match test(const Argument& ret, const Argument* args, size_t size) const;
 
     template<typename Ret, typename... Args>
     Match testParams(Args&&... args) const;
@@ -54,6 +60,21 @@ struct Function
     template<typename Ret, typename... Args>
     Ret call(Args&&... args) const;
 
+    // Skips the parameter check which must have already been done through
+    // testParams.
+    template<typename Ret, typename... Args>
+    Ret callUnchecked(Args&&... args) const;
+
+    // Constructs the return value in dst which must be uninitialized storage
+    // for an object of type dstType. Avoids boxing the return value in a Value.
+    template<typename... Args>
+    void callInto(void* dst, const Type* dstType, Args&&... args) const;
+
+    // Runtime arity version of call where the return value is written in ret.
+    void invoke(const Value* args, size_t size, Value& ret) const;
+    void invokeUnchecked(const Value* args, Value& ret) const;
+    Match testValues(const Value* args, size_t size) const;
+
 private:
 
     Match test(const Argument& value, const Argument& target) const;
@@ -61,10 +82,16 @@ private:
     Match testArguments(
             const std::vector<Argument>& value,
             const std::vector<Argument>& target) const;
+    Match testArguments(const Argument* value, size_t size) const;
 
     void* fn;
     std::string name_;
 
+    // Exact signature fast path. See TypedFunction.
+    const void* typedId;
+    TypedFunctionPtr typedFn;
+    void* typedTarget;
+
     Argument ret;
     std::vector<Argument> args;
 };
@@ -95,6 +95,14 @@ void reflectArguments(
     reflectArguments(args, std::forward<Rest>(rest)...);
 }
 
+template<typename... Rest>
+void reflectArguments(
+        std::vector<Argument>& args, ValueRef value, Rest&&... rest)
+{
+    args.emplace_back(value.argument());
+    reflectArguments(args, std::forward<Rest>(rest)...);
+}
+
 template<typename Arg, typename... Rest>
 void reflectArguments(std::vector<Argument>& args, Arg&& arg, Rest&&... rest)
 {
@@ -111,6 +119,64 @@ std::vector<Argument> reflectArguments(Args&&... args)
 }
 
 
+/******************************************************************************/
+/* REFLECT ARGUMENT ARRAY                                                     */
+/******************************************************************************/
+
+template<typename Fn>
+struct ArgumentArray
+{
+    typedef typename FunctionType<Fn>::Arguments Args;
+    typedef std::array<Argument, Args::size> type;
+};
+
+template<typename... Args>
+std::array<Argument, sizeof...(Args)> reflectArgumentArray(TypeVector<Args...>)
+{
+    return {{ Argument::make<Args>()... }};
+}
+
+template<typename Fn>
+typename ArgumentArray<Fn>::type reflectArgumentArray()
+{
+    return reflectArgumentArray(typename ArgumentArray<Fn>::Args());
+}
+
+
+/******************************************************************************/
+/* CALL ARGUMENT                                                              */
+/******************************************************************************/
+
+// Single argument version of reflectArguments which doesn't allocate.
+template<typename Arg>
+Argument callArgument(Arg&& arg)
+{
+    return Argument::make(std::forward<Arg>(arg));
+}
+
+inline Argument callArgument(Value& value) { return value.argument(); }
+inline Argument callArgument(const Value& value) { return value.argument(); }
+inline Argument callArgument(Value&& value) { return value.argument(); }
+inline Argument callArgument(ValueRef value) { return value.argument(); }
+
+
+/******************************************************************************/
+/* VALUE ARGUMENT                                                             */
+/******************************************************************************/
+
+// Values are passed by reference so that inline values aren't copied.
+template<typename Arg>
+Value valueArgument(Arg&& arg)
+{
+    return cast<Value>(std::forward<Arg>(arg));
+}
+
+inline Value valueArgument(Value& value) { return value.ref(); }
+inline Value valueArgument(const Value& value) { return value.ref(); }
+inline Value valueArgument(Value&& value) { return value.ref(); }
+inline Value valueArgument(ValueRef value) { return value.toValue(); }
+
+
 /******************************************************************************/
 /* FUNCTION                                                                   */
 /******************************************************************************/
@@ -118,9 +184,15 @@ std::vector<Argument> reflectArguments(Args&&... args)
 template<typename Fn>
 Function::
 Function(const std::string& name, Fn fn) :
-    fn(makeValueFunction(std::move(fn))),
     name_(name)
 {
+    auto valueFn = makeValueFunction(std::move(fn));
+    this->fn = valueFn;
+
+    typedId = TypedFunction<Fn>::id();
+    typedFn = TypedFunction<Fn>::ptr();
+    typedTarget = &valueFn->function();
+
     ret = reflectReturn<Fn>();
     args = reflectArguments<Fn>();
 }
@@ -132,11 +204,11 @@ Function::
 test() const
 {
     auto otherRet = reflectReturn<Fn>();
-    auto otherArgs = reflectArguments<Fn>();
+    auto otherArgs = reflectArgumentArray<Fn>();
 
     return combine(
             testReturn(otherRet, ret),
-            testArguments(otherArgs, args));
+            testArguments(otherArgs.data(), otherArgs.size()));
 }
 
 template<typename Ret, typename... Args>
@@ -145,11 +217,12 @@ Function::
 testParams(Args&&... args) const
 {
     auto otherRet = reflectReturn<Ret(Args...)>();
-    auto otherArgs = reflectArguments(std::forward<Args>(args)...);
+    std::array<Argument, sizeof...(Args)> otherArgs =
+        {{ callArgument(std::forward<Args>(args))... }};
 
     return combine(
             testReturn(otherRet, ret),
-            testArguments(otherArgs, this->args));
+            testArguments(otherArgs.data(), otherArgs.size()));
 }
 
 template<typename Ret, typename... Args>
@@ -157,15 +230,54 @@ Ret
 Function::
 call(Args&&... args) const
 {
-    if (testParams<Ret>(std::forward<Args>(args)...) == Match::None) {
+    bool isExact = typedId == signatureId<Ret(Args...)>();
+    Match match = isExact ?
+        Match::Exact : testParams<Ret>(std::forward<Args>(args)...);
+
+    if (match == Match::None) {
         reflectError("<%s> is not convertible to <%s>",
                 signature<Ret(Args...)>(), signature(*this));
     }
 
+    return callUnchecked<Ret>(std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+void
+Function::
+callInto(void* dst, const Type* dstType, Args&&... args) const
+{
+    if (dstType != ret.type()) {
+        reflectError("<%s> can't hold the return value of <%s>",
+                dstType->id(), signature(*this));
+    }
+
+    if (testParams<void>(std::forward<Args>(args)...) == Match::None) {
+        reflectError("<%s> is not convertible to <%s>",
+                signature<void(Args...)>(), signature(*this));
+    }
+
+    typedef ValueFunction<sizeof...(Args)> Fn;
+    Fn& valueFn = *static_cast<Fn*>(fn);
+
+    valueFn.callInto(dst, valueArgument(std::forward<Args>(args))...);
+}
+
+template<typename Ret, typename... Args>
+Ret
+Function::
+callUnchecked(Args&&... args) const
+{
+    if (typedId == signatureId<Ret(Args...)>()) {
+        typedef Ret (*Typed)(void*, Args...);
+        auto typed = reinterpret_cast<Typed>(typedFn);
+        return typed(typedTarget, std::forward<Args>(args)...);
+    }
+
     typedef ValueFunction<sizeof...(Args)> Fn;
-    Fn& typedFn = *static_cast<Fn*>(fn);
+    Fn& valueFn = *static_cast<Fn*>(fn);
 
-    Value ret = typedFn(cast<Value>(std::forward<Args>(args))...);
+    Value ret = valueFn(valueArgument(std::forward<Args>(args))...);
     return retCast<Ret>(ret);
 }
 
@@ -0,0 +1,115 @@
+/* insert_table.h                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Insert-only hash table with lock-free reads.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* INSERT TABLE                                                               */
+/******************************************************************************/
+
+/** Open-addressing table of items keyed by the string member Key. Items must
+    also provide their precomputed hash as a hash member and are never freed
+    by the table.
+
+    Readers probe the slots without locks while writers, which must be
+    serialized by the caller, fill in a slot once its item is fully
+    constructed. Growing creates a new slot array which is then published;
+    retired arrays are leaked as a reader could still be probing them.
+ */
+template<typename T, const std::string T::* Key>
+struct InsertTable
+{
+    explicit InsertTable(size_t capacity) : slots(new Slots(capacity)) {}
+
+    InsertTable(const InsertTable&) = delete;
+    InsertTable& operator=(const InsertTable&) = delete;
+
+    const T* find(const std::string& key, size_t hash) const
+    {
+        return slots.load(std::memory_order_acquire)->find(key, hash);
+    }
+
+    void insert(const T* item)
+    {
+        Slots* current = slots.load(std::memory_order_relaxed);
+
+        if (current->full()) {
+            size_t capacity = current->capacity();
+            std::unique_ptr<Slots> grown(new Slots(capacity * 2));
+
+            for (size_t i = 0; i < capacity; ++i) {
+                auto old = current->slots[i].load(std::memory_order_relaxed);
+                if (old) grown->insert(old);
+            }
+
+            current = grown.release();
+            slots.store(current, std::memory_order_release);
+        }
+
+        current->insert(item);
+    }
+
+    // Must be serialized with the writers.
+    template<typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        Slots* current = slots.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < current->capacity(); ++i) {
+            auto item = current->slots[i].load(std::memory_order_relaxed);
+            if (item) fn(item);
+        }
+    }
+
+private:
+
+    struct Slots
+    {
+        explicit Slots(size_t capacity) :
+            mask(capacity - 1), size(0),
+            slots(new std::atomic<const T*>[capacity])
+        {
+            for (size_t i = 0; i < capacity; ++i)
+                slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        size_t capacity() const { return mask + 1; }
+        bool full() const { return (size + 1) * 2 > capacity(); }
+
+        const T* find(const std::string& key, size_t hash) const
+        {
+            for (size_t i = hash;; ++i) {
+                auto item = slots[i & mask].load(std::memory_order_acquire);
+                if (!item) return nullptr;
+                if (item->hash == hash && item->*Key == key) return item;
+            }
+        }
+
+        void insert(const T* item)
+        {
+            for (size_t i = item->hash;; ++i) {
+                auto& slot = slots[i & mask];
+                if (slot.load(std::memory_order_relaxed)) continue;
+
+                slot.store(item, std::memory_order_release);
+                size++;
+                return;
+            }
+        }
+
+        const size_t mask;
+        size_t size;
+        std::unique_ptr< std::atomic<const T*>[] > slots;
+    };
+
+    std::atomic<Slots*> slots;
+};
+
+} // namespace reflect
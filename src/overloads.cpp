@@ -13,6 +13,61 @@ namespace reflect {
 /* OVERLOADS                                                                  */
 /******************************************************************************/
 
+Overloads::
+~Overloads()
+{
+    const Cache* it = cache.load(std::memory_order_relaxed);
+    while (it) {
+        const Cache* prev = it->prev;
+        delete it;
+        it = prev;
+    }
+}
+
+Overloads::
+Overloads(const Overloads& other) :
+    Traits(other),
+    overloads(other.overloads),
+    cache(nullptr)
+{}
+
+Overloads&
+Overloads::
+operator=(const Overloads& other)
+{
+    if (this == &other) return *this;
+
+    Traits::operator=(other);
+    overloads = other.overloads;
+    invalidate();
+
+    return *this;
+}
+
+Overloads::
+Overloads(Overloads&& other) :
+    Traits(std::move(other)),
+    overloads(std::move(other.overloads)),
+    cache(nullptr)
+{
+    other.invalidate();
+}
+
+Overloads&
+Overloads::
+operator=(Overloads&& other)
+{
+    if (this == &other) return *this;
+
+    Traits::operator=(std::move(other));
+    overloads = std::move(other.overloads);
+
+    invalidate();
+    other.invalidate();
+
+    return *this;
+}
+
 void
 Overloads::
 add(Function fn)
@@ -26,6 +81,144 @@ add(Function fn)
     }
 
     overloads.emplace_back(std::move(fn));
+    invalidate();
+}
+
+
+/******************************************************************************/
+/* RESOLVE                                                                    */
+/******************************************************************************/
+
+bool
+Overloads::CacheEntry::
+matches(const Argument& ret, const Argument* args, size_t size) const
+{
+    if (!(this->ret == ret) || this->args.size() != size) return false;
+
+    for (size_t i = 0; i < size; ++i)
+        if (!(this->args[i] == args[i])) return false;
+
+    return true;
+}
+
+const Overloads::CacheEntry*
+Overloads::
+findCached(const Argument& ret, const Argument* args, size_t size) const
+{
+    const Cache* current = cache.load(std::memory_order_acquire);
+    if (!current) return nullptr;
+
+    for (const auto& entry : current->entries)
+        if (entry.matches(ret, args, size)) return &entry;
+
+    return nullptr;
+}
+
+void
+Overloads::
+memoize(CacheEntry entry) const
+{
+    const Cache* current = cache.load(std::memory_order_acquire);
+
+    while (true) {
+        size_t size = current ? current->entries.size() : 0;
+        if (size >= CacheSize) return;
+
+        std::unique_ptr<Cache> next(new Cache);
+        next->prev = current;
+        next->entries.reserve(size + 1);
+
+        if (current) {
+            for (const auto& other : current->entries) {
+                const auto& args = entry.args;
+                if (other.matches(entry.ret, args.data(), args.size())) return;
+                next->entries.push_back(other);
+            }
+        }
+        next->entries.push_back(entry);
+
+        if (cache.compare_exchange_weak(current, next.get())) {
+            next.release();
+            return;
+        }
+    }
+}
+
+// Replaced caches are kept in the chain and freed by the destructor.
+void
+Overloads::
+invalidate()
+{
+    const Cache* current = cache.load(std::memory_order_acquire);
+    if (!current) return;
+
+    do {
+        if (current->entries.empty()) return;
+
+        std::unique_ptr<Cache> next(new Cache);
+        next->prev = current;
+
+        if (cache.compare_exchange_weak(current, next.get())) {
+            next.release();
+            return;
+        }
+    } while (current);
+}
+
+const Function&
+Overloads::
+resolve(const Argument& ret, const Argument* args, size_t size) const
+{
+    Resolution result;
+    const Function* bestFn = nullptr;
+
+    if (const CacheEntry* entry = findCached(ret, args, size)) {
+        result = entry->result;
+        bestFn = entry->fn;
+    }
+
+    else {
+        bool ambiguous = false;
+
+        for (const auto& fn : overloads) {
+
+            Match match = fn.test(ret, args, size);
+            if (match == Match::None) continue;
+
+            if (bestFn && match == Match::Partial) {
+                ambiguous = true;
+                continue;
+            }
+
+            bestFn = &fn;
+
+            if (match == Match::Exact) {
+                ambiguous = false;
+                break;
+            }
+        }
+
+        if (!bestFn) result = Resolution::None;
+        else if (ambiguous) result = Resolution::Ambiguous;
+        else result = Resolution::Found;
+
+        std::vector<Argument> params(args, args + size);
+        memoize(CacheEntry{ ret, std::move(params), result, bestFn });
+    }
+
+    if (result == Resolution::None) {
+        reflectError("no overload <%s> available for function <%s>",
+                signature(ret, std::vector<Argument>(args, args + size)),
+                name());
+    }
+
+    if (result == Resolution::Ambiguous) {
+        reflectError("ambiguous function call <%s> for function <%s>",
+                signature(ret, std::vector<Argument>(args, args + size)),
+                name());
+    }
+
+    return *bestFn;
 }
 
 bool
@@ -60,6 +253,27 @@ get(const Argument& ret, const std::vector<Argument>& args) const
             signature(ret, args), name());
 }
 
+void
+Overloads::
+invoke(const Value* args, size_t size, Value& ret) const
+{
+    enum { Inline = 8 };
+
+    Argument inlineParams[Inline];
+    std::vector<Argument> heapParams;
+
+    Argument* params = inlineParams;
+    if (size > Inline) {
+        heapParams.resize(size);
+        params = heapParams.data();
+    }
+
+    for (size_t i = 0; i < size; ++i) params[i] = args[i].argument();
+
+    const Function& fn = resolve(Argument::make<Value>(), params, size);
+    fn.invokeUnchecked(args, ret);
+}
+
 std::string
 Overloads::
 name() const
@@ -3,6 +3,14 @@
    FreeBSD-style copyright and disclaimer apply
 
    Overloads class thingy.
+
+   The result of overload resolution is memoized for each signature it's
+   invoked with, including failed resolutions, in an immutable cache that is
+   read without locks. Inserting a signature publishes a copy of the cache and
+   adding an overload publishes an empty one. Replaced caches are only freed
+   along with the Overloads since readers could still be using them. Copies
+   start out with an empty cache as the memoized results point into the
+   overloads they were resolved from.
 */
 
 #include "reflect.h"
@@ -16,6 +24,15 @@ namespace reflect {
 
 struct Overloads : public Traits
 {
+    Overloads() : cache(nullptr) {}
+    ~Overloads();
+
+    Overloads(const Overloads& other);
+    Overloads& operator=(const Overloads& other);
+
+    Overloads(Overloads&& other);
+    Overloads& operator=(Overloads&& other);
+
     // For debugging purposes only.
     std::string name() const;
 
@@ -34,13 +51,50 @@ struct Overloads : public Traits
     const Function& get() const;
     const Function& get(const Argument& ret, const std::vector<Argument>& args) const;
 
+    // Picks the best overload for the given parameters or errors out if none
+    // or more then one are available.
+    template<typename Ret, typename... Args>
+    const Function& resolve(Args&&... args) const;
+    const Function& resolve(
+            const Argument& ret, const Argument* args, size_t size) const;
+
     template<typename Ret, typename... Args>
     Ret call(Args&&... args) const;
 
+    // Runtime arity version of call where the return value is written in ret.
+    void invoke(const Value* args, size_t size, Value& ret) const;
+
     std::string print(size_t indent = 0) const;
 
 private:
-    std::vector<Function> overloads;
+
+    enum { CacheSize = 16 };
+    enum struct Resolution { Found, None, Ambiguous };
+
+    struct CacheEntry
+    {
+        Argument ret;
+        std::vector<Argument> args;
+        Resolution result;
+        const Function* fn;
+
+        bool matches(
+                const Argument& ret, const Argument* args, size_t size) const;
+    };
+
+    struct Cache
+    {
+        const Cache* prev;
+        std::vector<CacheEntry> entries;
+    };
+
+    const CacheEntry* findCached(
+            const Argument& ret, const Argument* args, size_t size) const;
+    void memoize(CacheEntry entry) const;
+    void invalidate();
+
+    MetaVector<Function, MetaCategory::Functions> overloads;
+    mutable std::atomic<const Cache*> cache;
 };
 
 } // reflect
@@ -40,48 +40,23 @@ get() const
 }
 
 template<typename Ret, typename... Args>
-Ret
+const Function&
 Overloads::
-call(Args&&... args) const
+resolve(Args&&... args) const
 {
-    const Function* bestFn = nullptr;
-    bool ambiguous = false;
-
-    for (const auto& fn : overloads) {
-
-        Match match = fn.testParams<Ret>(std::forward<Args>(args)...);
-        if (match == Match::None) continue;
-
-        if (bestFn && match == Match::Partial) {
-            ambiguous = true;
-            continue;
-        }
-
-        bestFn = &fn;
-
-        if (match == Match::Exact) {
-            ambiguous = false;
-            break;
-        }
-    }
+    std::array<Argument, sizeof...(Args)> params =
+        {{ callArgument(std::forward<Args>(args))... }};
 
-    if (!bestFn) {
-        reflectError("no overload <%s> available for function <%s>",
-                signature(
-                        Argument::make<Ret>(),
-                        reflectArguments(std::forward<Args>(args)...)),
-                name());
-    }
-
-    if (ambiguous) {
-        reflectError("ambiguous function call <%s> for function <%s>",
-                signature(
-                        Argument::make<Ret>(),
-                        reflectArguments(std::forward<Args>(args)...)),
-                name());
-    }
+    return resolve(Argument::make<Ret>(), params.data(), params.size());
+}
 
-    return bestFn->call<Ret>(std::forward<Args>(args)...);
+template<typename Ret, typename... Args>
+Ret
+Overloads::
+call(Args&&... args) const
+{
+    const Function& fn = resolve<Ret>(std::forward<Args>(args)...);
+    return fn.callUnchecked<Ret>(std::forward<Args>(args)...);
 }
 
 } // reflect
@@ -0,0 +1,205 @@
+/* perfect_hash.h                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Frozen minimal perfect hash table keyed by interned symbols.
+
+   Built once using hash-and-displace: keys are first split into buckets using
+   their hash and, starting with the largest bucket, we search for a seed that
+   maps every key of the bucket to a free slot. A lookup is therefore a single
+   hash of the key, a bucket read, a mix and one key compare.
+*/
+
+#include "reflect.h"
+#pragma once
+
+#include <cstring>
+#include <algorithm>
+
+namespace reflect {
+
+/******************************************************************************/
+/* HASH NAME                                                                  */
+/******************************************************************************/
+
+// Word at a time multiply-xor hash which is good enough for the short
+// identifiers we deal with. Tails are read as overlapping fixed size loads to
+// avoid variable length copies.
+inline uint64_t hashWord(uint64_t hash, uint64_t word)
+{
+    hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+    return hash ^ (hash >> 29);
+}
+
+inline uint64_t hashName(const char* str, size_t len)
+{
+    const char* end = str + len;
+    uint64_t hash = hashWord(0, len);
+
+    if (len >= 8) {
+        uint64_t word;
+        for (; end - str > 8; str += 8) {
+            std::memcpy(&word, str, 8);
+            hash = hashWord(hash, word);
+        }
+        std::memcpy(&word, end - 8, 8);
+        hash = hashWord(hash, word);
+    }
+
+    else if (len >= 4) {
+        uint32_t head, tail;
+        std::memcpy(&head, str, 4);
+        std::memcpy(&tail, end - 4, 4);
+        hash = hashWord(hash, uint64_t(head) << 32 | tail);
+    }
+
+    else if (len) {
+        uint64_t word = uint8_t(str[0]);
+        word = word << 8 | uint8_t(str[len / 2]);
+        word = word << 8 | uint8_t(end[-1]);
+        hash = hashWord(hash, word);
+    }
+
+    hash ^= hash >> 32;
+    return hash * 0x9e3779b97f4a7c15ULL;
+}
+
+
+/******************************************************************************/
+/* PERFECT HASH                                                               */
+/******************************************************************************/
+
+// Entries only point to the strings of their symbols which are never freed.
+// The table is part of the metadata of a type and is therefore allocated like
+// the rest of the type's tables.
+template<typename T>
+struct PerfectHash
+{
+    PerfectHash() {}
+
+    // Returns false if no perfect hash could be found in which case the table
+    // is left empty.
+    bool build(const std::vector< std::pair<Symbol, T> >& items);
+
+    size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+
+    const T* find(const char* key, size_t len) const
+    {
+        if (entries.empty()) return nullptr;
+
+        uint64_t hash = hashName(key, len);
+        uint32_t seed = seeds[reduce(hash, seeds.size())];
+        const Entry& entry = entries[reduce(mix(hash, seed), entries.size())];
+
+        if (entry.len != len) return nullptr;
+        if (std::memcmp(entry.key, key, len)) return nullptr;
+        return &entry.value;
+    }
+
+    const T* find(const std::string& key) const
+    {
+        return find(key.data(), key.size());
+    }
+
+private:
+
+    enum { MaxSeed = 1 << 16 };
+
+    // Maps the upper bits of hash to [0, n) without a division.
+    static size_t reduce(uint64_t hash, size_t n)
+    {
+        return (uint64_t(uint32_t(hash >> 32)) * n) >> 32;
+    }
+
+    static uint64_t mix(uint64_t hash, uint32_t seed)
+    {
+        hash ^= uint64_t(seed) * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    struct Entry
+    {
+        const char* key;
+        size_t len;
+        T value;
+    };
+
+    MetaVector<uint32_t, MetaCategory::Types> seeds;
+    MetaVector<Entry, MetaCategory::Types> entries;
+};
+
+
+template<typename T>
+bool
+PerfectHash<T>::
+build(const std::vector< std::pair<Symbol, T> >& items)
+{
+    seeds.clear();
+    entries.clear();
+    if (items.empty()) return true;
+
+    size_t n = items.size();
+    size_t buckets = (n + 3) / 4;
+
+    std::vector<uint64_t> hashes(n);
+    std::vector< std::vector<size_t> > keys(buckets);
+
+    for (size_t i = 0; i < n; ++i) {
+        const auto& key = items[i].first.str();
+        hashes[i] = hashName(key.data(), key.size());
+        keys[reduce(hashes[i], buckets)].push_back(i);
+    }
+
+    std::vector<size_t> order(buckets);
+    for (size_t i = 0; i < buckets; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                return keys[lhs].size() > keys[rhs].size();
+            });
+
+    std::vector<bool> taken(n, false);
+    std::vector<size_t> slots(n);
+    std::vector<uint32_t> result(buckets, 0);
+
+    for (size_t bucket : order) {
+        const auto& bucketKeys = keys[bucket];
+        if (bucketKeys.empty()) break;
+
+        uint32_t seed = 0;
+        for (; seed < MaxSeed; ++seed) {
+            size_t placed = 0;
+
+            for (; placed < bucketKeys.size(); ++placed) {
+                size_t slot = reduce(mix(hashes[bucketKeys[placed]], seed), n);
+                if (taken[slot]) break;
+
+                taken[slot] = true;
+                slots[bucketKeys[placed]] = slot;
+            }
+
+            if (placed == bucketKeys.size()) break;
+
+            // Roll back the partial placement and try the next seed.
+            for (size_t i = 0; i < placed; ++i)
+                taken[slots[bucketKeys[i]]] = false;
+        }
+
+        if (seed == MaxSeed) return false;
+        result[bucket] = seed;
+    }
+
+    seeds.assign(result.begin(), result.end());
+
+    entries.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        const auto& key = items[i].first.str();
+        entries[slots[i]] = Entry{ key.data(), key.size(), items[i].second };
+    }
+
+    return true;
+}
+
+} // namespace reflect
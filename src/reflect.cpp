@@ -10,14 +10,18 @@
 #include "error.cpp"
 #include "ref_type.cpp"
 
+#include "symbol.cpp"
+#include "arena.cpp"
 #include "registry.cpp"
 #include "argument.cpp"
 #include "cast.cpp"
 #include "traits.cpp"
 #include "value.cpp"
+#include "value_ref.cpp"
 #include "value_function.cpp"
 #include "scope.cpp"
 #include "type.cpp"
 #include "field.cpp"
+#include "field_ref.cpp"
 #include "function.cpp"
 #include "overloads.cpp"
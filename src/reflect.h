@@ -15,9 +15,12 @@
 #pragma once
 
 #include <string>
+#include <atomic>
+#include <mutex>
 #include <memory>
 #include <functional>
 #include <type_traits>
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -38,30 +41,42 @@ namespace reflect {
 struct Type;
 struct Scope;
 struct Value;
+struct ValueRef;
 struct Field;
+struct FieldRef;
 struct Function;
 struct Overloads;
 
 } // namespace reflect
 
+#include "symbol.h"
+#include "arena.h"
+#include "insert_table.h"
 #include "registry.h"
+#include "perfect_hash.h"
 #include "argument.h"
 #include "value.h"
 #include "traits.h"
 #include "cast.h"
+#include "value_ref.h"
 #include "value_function.h"
 #include "field.h"
+#include "field_ref.h"
 #include "function.h"
 #include "overloads.h"
+#include "call_site.h"
 #include "type.h"
 #include "scope.h"
 
 #include "traits.tcc"
 #include "argument.tcc"
 #include "value.tcc"
+#include "value_ref.tcc"
 #include "field.tcc"
+#include "field_ref.tcc"
 #include "function.tcc"
 #include "overloads.tcc"
+#include "call_site.tcc"
 #include "type.tcc"
 #include "scope.tcc"
 
@@ -69,3 +84,4 @@ struct Overloads;
 
 #include "types/primitives.h"
 #include "types/reflect/value.h"
+#include "types/reflect/value_ref.h"
@@ -8,30 +8,420 @@
 #include "reflect.h"
 
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <exception>
+#include <algorithm>
 
 namespace reflect {
 
 /******************************************************************************/
-/* REGISTRY STATE                                                             */
+/* REGISTRY ENTRY                                                             */
 /******************************************************************************/
 
 namespace {
 
+struct LoadingThread;
+
+struct RegistryEntry
+{
+    explicit RegistryEntry(std::string id) :
+        id(std::move(id)), type(nullptr), loaded(false), owner(nullptr)
+    {}
+
+    const std::string id;
+
+    // Protected by the registry lock until it's consumed by the loader.
+    std::function<void(Type*)> loader;
+
+    std::once_flag once;
+
+    // Published before the loader runs so that recursive lookups made by the
+    // loader (directly or through other loaders) can find the type.
+    std::atomic<Type*> type;
+    std::atomic<bool> loaded;
+
+    // Thread running the loader. Protected by the registry's wait lock.
+    LoadingThread* owner;
+};
+
+
+/******************************************************************************/
+/* LOADING THREAD                                                             */
+/******************************************************************************/
+
+// Wait-for graph of the threads running loaders which is used to detect when
+// blocking on an entry would deadlock. Protected by the registry's wait lock.
+struct LoadingThread
+{
+    LoadingThread() : waitingOn(nullptr) {}
+    RegistryEntry* waitingOn;
+};
+
+thread_local LoadingThread loadingThread;
+
+
+/******************************************************************************/
+/* REGISTRY NAME                                                              */
+/******************************************************************************/
+
+// Either the id of an entry or one of its aliases. Never freed.
+struct RegistryName
+{
+    RegistryName(std::string name, RegistryEntry* entry) :
+        name(std::move(name)),
+        hash(std::hash<std::string>()(this->name)),
+        entry(entry)
+    {}
+
+    const std::string name;
+    const size_t hash;
+    RegistryEntry* const entry;
+};
+
+// Inserts are serialized by the registry lock.
+typedef InsertTable<RegistryName, &RegistryName::name> RegistryIndex;
+
+
+/******************************************************************************/
+/* RECORD RANGES                                                              */
+/******************************************************************************/
+
+// Ranges are registered by static constructors so they must not depend on any
+// dynamically initialized state. Everything here is zero-initialized.
+struct RecordRange
+{
+    std::atomic<const TypeRecord*> first;
+    std::atomic<const TypeRecord*> last;
+};
+
+enum { MaxRecordRanges = 1024 };
+RecordRange recordRanges_[MaxRecordRanges];
+std::atomic<size_t> recordRangeCount_;
+
+
+/******************************************************************************/
+/* REGISTRY STATE                                                             */
+/******************************************************************************/
+
 struct RegistryState
 {
+    enum { Categories = size_t(MetaCategory::Scopes) + 1 };
+
+    RegistryState() : index(1024), indexedRanges(0)
+    {
+        std::fill(std::begin(allocated), std::end(allocated), 0);
+        std::fill(std::begin(freed), std::end(freed), 0);
+    }
+
+    // Serializes all writers. Readers never take it unless they miss.
     std::mutex lock;
-    std::unordered_map<std::string, const Type*> types;
-    std::unordered_map<std::string, std::string> aliases;
-    std::unordered_map<std::string, std::function<void(Type*)> > loaders;
+
+    // Protects the ownership of the entries being loaded and what each loading
+    // thread is waiting on.
+    std::mutex waitLock;
+    RegistryIndex index;
+
+    // Number of record ranges that were added to the index.
+    size_t indexedRanges;
+
+    // Metadata is allocated while loaders run which can happen concurrently so
+    // the arena needs its own lock.
+    std::mutex arenaLock;
+    Arena arena;
+    size_t allocated[Categories];
+    size_t freed[Categories];
+
     Scope scopes;
+
+    // Stats of every type loaded while preload() is running.
+    std::mutex statsLock;
+    std::vector< std::vector<LoadStats>* > statsSinks;
 };
 
-RegistryState* registry_ = nullptr;
+std::atomic<RegistryState*> registry_;
 
 RegistryState& getRegistry()
 {
-    if (!registry_) registry_ = new RegistryState();
-    return *registry_;
+    RegistryState* registry = registry_.load(std::memory_order_acquire);
+    if (registry) return *registry;
+
+    std::unique_ptr<RegistryState> state(new RegistryState());
+    if (registry_.compare_exchange_strong(registry, state.get()))
+        return *state.release();
+    return *registry;
+}
+
+// Number of loaders currently running on this thread.
+thread_local size_t loadDepth = 0;
+
+struct LoadGuard
+{
+    LoadGuard() { loadDepth++; }
+    ~LoadGuard() { loadDepth--; }
+};
+
+double elapsedSince(std::chrono::steady_clock::time_point start)
+{
+    typedef std::chrono::duration<double> Seconds;
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast<Seconds>(elapsed).count();
+}
+
+// Time spent by the current loader loading or waiting on its dependencies.
+thread_local double dependencyTime = 0;
+
+// Measures the time spent in a loader minus the time spent on its
+// dependencies so that each type is only charged for its own work.
+struct LoadTimer
+{
+    LoadTimer() :
+        start(std::chrono::steady_clock::now()), outer(dependencyTime)
+    {
+        dependencyTime = 0;
+    }
+
+    ~LoadTimer() { dependencyTime = outer; }
+
+    double elapsed() const { return elapsedSince(start) - dependencyTime; }
+
+    std::chrono::steady_clock::time_point start;
+    double outer;
+};
+
+
+const RegistryName*
+findName(RegistryState& registry, const std::string& name, size_t hash)
+{
+    return registry.index.find(name, hash);
+}
+
+// Must be called with the registry lock held.
+RegistryEntry*
+insertName(
+        RegistryState& registry, const std::string& name, RegistryEntry* entry)
+{
+    if (!entry) entry = new RegistryEntry(name);
+    registry.index.insert(new RegistryName(name, entry));
+    return entry;
+}
+
+// Must be called with the registry lock held.
+RegistryEntry* entryFor(RegistryState& registry, const std::string& id)
+{
+    size_t hash = std::hash<std::string>()(id);
+    if (auto name = findName(registry, id, hash)) return name->entry;
+    return insertName(registry, id, nullptr);
+}
+
+// Must be called with the registry lock held.
+void addLoader(
+        RegistryState& registry,
+        const std::string& id,
+        std::function<void(Type*)> loader)
+{
+    RegistryEntry* entry = entryFor(registry, id);
+
+    // If we already have a loader then too-bad.
+    if (entry->loader || entry->type.load(std::memory_order_relaxed)) return;
+
+    entry->loader = std::move(loader);
+    registry.scopes.addType(id);
+}
+
+// Must be called with the registry lock held.
+void indexRecords(RegistryState& registry)
+{
+    size_t count = recordRangeCount_.load(std::memory_order_acquire);
+    count = std::min<size_t>(count, MaxRecordRanges);
+
+    for (; registry.indexedRanges < count; registry.indexedRanges++) {
+        auto& range = recordRanges_[registry.indexedRanges];
+
+        // Still being registered; we'll pick it up on the next lookup.
+        const TypeRecord* it = range.first.load(std::memory_order_acquire);
+        if (!it) break;
+
+        const TypeRecord* last = range.last.load(std::memory_order_relaxed);
+        for (; it != last; ++it) addLoader(registry, it->id, it->loader);
+    }
+}
+
+
+/******************************************************************************/
+/* LOAD                                                                       */
+/******************************************************************************/
+
+// Clears the ownership of an entry once its loader is done, whether it
+// succeeded or not.
+struct OwnerGuard
+{
+    OwnerGuard(RegistryState& registry, RegistryEntry& entry, Type* type) :
+        registry(registry), entry(entry)
+    {
+        std::lock_guard<std::mutex> guard(registry.waitLock);
+        entry.type.store(type, std::memory_order_release);
+        entry.owner = &loadingThread;
+
+        // We might have been waiting on the entry before ending up loading it.
+        loadingThread.waitingOn = nullptr;
+    }
+
+    ~OwnerGuard()
+    {
+        std::lock_guard<std::mutex> guard(registry.waitLock);
+        entry.owner = nullptr;
+    }
+
+    RegistryState& registry;
+    RegistryEntry& entry;
+};
+
+void recordStats(
+        RegistryState& registry, const std::string& id, double elapsed)
+{
+    std::lock_guard<std::mutex> guard(registry.statsLock);
+    for (auto sink : registry.statsSinks) sink->push_back({ id, elapsed });
+}
+
+// Clears what the thread is waiting on once it's done waiting.
+struct WaitGuard
+{
+    explicit WaitGuard(RegistryState& registry) : registry(registry) {}
+
+    ~WaitGuard()
+    {
+        if (!loadDepth) return;
+
+        std::lock_guard<std::mutex> guard(registry.waitLock);
+        loadingThread.waitingOn = nullptr;
+    }
+
+    RegistryState& registry;
+};
+
+void loadEntry(RegistryState& registry, RegistryEntry& entry)
+{
+    // The loader is copied so that it's still around if it throws and the
+    // load is retried.
+    std::function<void(Type*)> loader;
+    {
+        std::lock_guard<std::mutex> guard(registry.lock);
+        indexRecords(registry);
+        loader = entry.loader;
+    }
+
+    if (!loader) reflectError("no loader found for <%s>", entry.id);
+
+    LoadTimer timer;
+    {
+        // The type is constructed under the guard so that its containers are
+        // allocated from the arena.
+        LoadGuard guard;
+
+        void* ptr = Registry::allocate(
+                MetaCategory::Types, sizeof(Type), alignof(Type));
+        Type* type = new (ptr) Type(entry.id);
+
+        OwnerGuard owner(registry, entry, type);
+        loader(type);
+        type->finalize();
+    }
+
+    recordStats(registry, entry.id, timer.elapsed());
+
+    {
+        std::lock_guard<std::mutex> guard(registry.lock);
+        entry.loader = nullptr;
+    }
+
+    entry.loaded.store(true, std::memory_order_release);
+}
+
+RegistryEntry& findEntry(RegistryState& registry, const std::string& id)
+{
+    size_t hash = std::hash<std::string>()(id);
+
+    const RegistryName* name = findName(registry, id, hash);
+    if (!name) {
+        std::lock_guard<std::mutex> guard(registry.lock);
+        indexRecords(registry);
+        name = findName(registry, id, hash);
+    }
+
+    if (!name) reflectError("no loader found for <%s>", id);
+    return *name->entry;
+}
+
+// A loader asking for a type that its own thread is loading gets the partially
+// loaded type which is what allows recursive types. The same goes when the
+// type is being loaded by another thread which is itself waiting, directly or
+// not, on a type loaded by this thread: blocking would deadlock so the cycle
+// is broken the same way it is for recursive types. Any other loader blocks
+// until the type is fully loaded.
+//
+// Must be called with the wait lock held.
+Type* partialEntry(RegistryEntry& entry)
+{
+    // Cycles are never added to the graph so this always terminates.
+    RegistryEntry* it = &entry;
+    while (it && it->owner) {
+        if (it->owner == &loadingThread)
+            return entry.type.load(std::memory_order_acquire);
+        it = it->owner->waitingOn;
+    }
+
+    return nullptr;
+}
+
+const Type* getEntry(RegistryState& registry, RegistryEntry& entry)
+{
+    if (entry.loaded.load(std::memory_order_acquire))
+        return entry.type.load(std::memory_order_relaxed);
+
+    // Threads that aren't running a loader don't own any entries so they can
+    // always block safely.
+    if (loadDepth) {
+        std::lock_guard<std::mutex> guard(registry.waitLock);
+        if (Type* type = partialEntry(entry)) return type;
+        loadingThread.waitingOn = &entry;
+    }
+
+    WaitGuard wait(registry);
+    auto start = std::chrono::steady_clock::now();
+
+    std::call_once(entry.once, [&] { loadEntry(registry, entry); });
+
+    if (loadDepth) dependencyTime += elapsedSince(start);
+    return entry.type.load(std::memory_order_acquire);
+}
+
+
+/******************************************************************************/
+/* PRELOAD                                                                    */
+/******************************************************************************/
+
+std::vector<RegistryEntry*>
+pendingEntries(RegistryState& registry, const std::string& prefix)
+{
+    std::vector<RegistryEntry*> result;
+
+    std::lock_guard<std::mutex> guard(registry.lock);
+    indexRecords(registry);
+
+    registry.index.forEach([&] (const RegistryName* name) {
+                // Skip aliases so that each entry is only listed once.
+                RegistryEntry* entry = name->entry;
+                if (name->name != entry->id) return;
+
+                if (!entry->loader) return;
+                if (entry->id.compare(0, prefix.size(), prefix)) return;
+
+                result.push_back(entry);
+            });
+
+    return result;
 }
 
 } // namespace anonymous
@@ -45,75 +435,173 @@ Scope*
 Registry::
 globalScope()
 {
-    return &getRegistry().scopes;
+    auto& registry = getRegistry();
+    {
+        std::lock_guard<std::mutex> guard(registry.lock);
+        indexRecords(registry);
+    }
+    return &registry.scopes;
 }
 
 const Type*
 Registry::
 get(const std::string& id)
 {
+    if (id.empty()) reflectError("can't add type for <%s>", id);
+
     auto& registry = getRegistry();
-    std::lock_guard<std::mutex>(registry.lock);
+    return getEntry(registry, findEntry(registry, id));
+}
 
-    const std::string* pId = &id;
+const Type*
+Registry::
+get(const std::string& id, std::atomic<const Type*>& cache)
+{
+    if (id.empty()) reflectError("can't add type for <%s>", id);
 
-    auto aliasIt = registry.aliases.find(*pId);
-    if (aliasIt != registry.aliases.end())
-        pId = &aliasIt->second;
+    auto& registry = getRegistry();
+    RegistryEntry& entry = findEntry(registry, id);
+    const Type* type = getEntry(registry, entry);
+
+    // Partially loaded types can only be handed out to loaders.
+    if (entry.loaded.load(std::memory_order_acquire))
+        cache.store(type, std::memory_order_release);
 
-    auto typeIt = registry.types.find(*pId);
-    return typeIt != registry.types.end() ? typeIt->second : load(*pId);
+    return type;
 }
 
+void
+Registry::
+add(const std::string& id, std::function<void(Type*)> loader)
+{
+    if (id.empty() || !loader)
+        reflectError("can't add loader for<%s>", id);
+
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
 
-const Type*
+    indexRecords(registry);
+    addLoader(registry, id, std::move(loader));
+}
+
+void
 Registry::
-load(const std::string& id)
+add(const TypeRecord* first, const TypeRecord* last)
 {
-    if (id.empty()) reflectError("can't add type for <%s>", id);
+    if (first == last) return;
+
+    size_t index = recordRangeCount_.fetch_add(1, std::memory_order_acq_rel);
+    if (index >= MaxRecordRanges)
+        reflectError("too many type record ranges: %lu", index);
+
+    auto& range = recordRanges_[index];
+    range.last.store(last, std::memory_order_relaxed);
+    range.first.store(first, std::memory_order_release);
+}
+
+std::vector<LoadStats>
+Registry::
+preload(const std::string& prefix, size_t threads)
+{
+    if (!threads) threads = std::max(1u, std::thread::hardware_concurrency());
 
     auto& registry = getRegistry();
 
-    auto it = registry.loaders.find(id);
-    if (it == registry.loaders.end())
-        reflectError("no loader found for <%s>", id);
+    // Stats are recorded by the loads themselves so that types loaded as a
+    // dependency of another type are also accounted for.
+    std::vector<LoadStats> stats;
+    {
+        std::lock_guard<std::mutex> guard(registry.statsLock);
+        registry.statsSinks.push_back(&stats);
+    }
 
-    auto loader = std::move(it->second);
-    registry.loaders.erase(it);
+    std::mutex lock;
+    std::exception_ptr error;
+
+    // Loaders can register new loaders (eg. templates) so keep going until
+    // we run out of work.
+    for (auto pending = pendingEntries(registry, prefix);
+         !pending.empty() && !error;
+         pending = pendingEntries(registry, prefix))
+    {
+        std::atomic<size_t> next(0);
+
+        auto worker = [&] {
+            for (size_t i = next++; i < pending.size(); i = next++) {
+                try { getEntry(registry, *pending[i]); }
+                catch (...) {
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (!error) error = std::current_exception();
+                    return;
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < threads; ++i) workers.emplace_back(worker);
+
+        worker();
+        for (auto& thread : workers) thread.join();
+    }
 
-    Type* type;
-    add(id, type = new Type(id));
+    {
+        std::lock_guard<std::mutex> guard(registry.statsLock);
+        auto& sinks = registry.statsSinks;
+        sinks.erase(std::find(sinks.begin(), sinks.end(), &stats));
+    }
 
-    loader(type);
-    return type;
+    if (error) std::rethrow_exception(error);
+    return stats;
 }
 
-void
+bool
 Registry::
-add(const std::string& id, const Type* type)
+isLoading()
 {
-    if (id.empty() || !type)
-        reflectError("can't add type for <%s>", id);
+    return loadDepth;
+}
 
+void*
+Registry::
+allocate(MetaCategory category, size_t size, size_t align)
+{
     auto& registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.arenaLock);
 
-    auto ret = registry.types.emplace(id, type);
-    if (!ret.second) reflectError("<%s> already has a type", id);
+    registry.allocated[size_t(category)] += size;
+    return registry.arena.allocate(size, align);
 }
 
 void
 Registry::
-add(const std::string& id, std::function<void(Type*)> loader)
+deallocate(MetaCategory category, size_t size)
 {
-    if (id.empty() || !loader)
-        reflectError("can't add loader for<%s>", id);
-
     auto& registry = getRegistry();
-    std::lock_guard<std::mutex>(registry.lock);
+    std::lock_guard<std::mutex> guard(registry.arenaLock);
 
-    // If we already have a loader then too-bad.
-    registry.loaders.emplace(std::move(id), std::move(loader));
-    registry.scopes.addType(id);
+    registry.freed[size_t(category)] += size;
+}
+
+MemoryReport
+Registry::
+memoryReport()
+{
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.arenaLock);
+
+    auto bytes = [&] (MetaCategory category) {
+        size_t i = size_t(category);
+        return registry.allocated[i] - registry.freed[i];
+    };
+
+    MemoryReport report;
+    report.types = bytes(MetaCategory::Types);
+    report.functions = bytes(MetaCategory::Functions);
+    report.fields = bytes(MetaCategory::Fields);
+    report.traits = bytes(MetaCategory::Traits);
+    report.scopes = bytes(MetaCategory::Scopes);
+    report.reserved = registry.arena.reserved();
+    return report;
 }
 
 void
@@ -124,14 +612,20 @@ alias(const std::string& id, const std::string& alias)
         reflectError("<%s> can't be aliased to <%s>", alias, id);
 
     auto& registry = getRegistry();
-    std::lock_guard<std::mutex>(registry.lock);
+    std::lock_guard<std::mutex> guard(registry.lock);
+
+    indexRecords(registry);
 
-    auto ret = registry.aliases.emplace(std::move(alias), std::move(id));
-    if (!ret.second) {
+    size_t hash = std::hash<std::string>()(alias);
+    if (const RegistryName* name = findName(registry, alias, hash)) {
         reflectError(
                 "<%s> can't be aliased to <%s> because it's already aliased to <%s>",
-                alias, id, ret.first->second);
+                alias, id, name->entry->id);
     }
+
+    // The aliased type might not have registered its loader yet so we create
+    // its entry ahead of time.
+    insertName(registry, alias, entryFor(registry, id));
 }
 
 
@@ -3,6 +3,29 @@
    FreeBSD-style copyright and disclaimer apply
 
    Type registry.
+
+   Lookups are lock-free once a type has been published: the id index is an
+   insert-only open-addressing table whose slots are read without locks and
+   which is re-published under the writer lock when it needs to grow. Each type
+   is loaded exactly once through its own once flag so threads loading
+   different types never wait on each other.
+
+   Typed lookups are additionally cached per type in TypeCache once the type is
+   fully loaded so type<T>() is a single load after warm-up.
+
+   Loaders can also be run ahead of time through preload() which loads every
+   pending type on a pool of worker threads.
+
+   Types reflected through reflectType don't run any code at startup: their
+   {id, loader} records are emitted as constant data in the reflect_types
+   linker section and are indexed by the registry on first use. Each shared
+   object only registers the bounds of its section through a single static
+   constructor.
+
+   The metadata of the types (the types themselves, their member tables,
+   functions, fields, traits and scopes) is allocated from a bump arena owned
+   by the registry through MetaAllocator. memoryReport() breaks down the bytes
+   in use by category.
 */
 
 #include "reflect.h"
@@ -11,6 +34,24 @@
 namespace reflect {
 
 struct Type;
+struct TypeRecord;
+
+} // namespace reflect
+
+
+/******************************************************************************/
+/* SECTION BOUNDS                                                             */
+/******************************************************************************/
+
+// Provided by the linker for each shared object that contains records. They're
+// hidden so that every object refers to its own section and weak so that
+// objects without records still link.
+extern "C" {
+extern const reflect::TypeRecord __start_reflect_types[] reflectWeak reflectHidden;
+extern const reflect::TypeRecord __stop_reflect_types[] reflectWeak reflectHidden;
+}
+
+namespace reflect {
 
 
 /******************************************************************************/
@@ -22,6 +63,67 @@ template<typename T, typename Enable = void> struct ReflectScope;
 template<typename T, typename Enable = void> struct Loader;
 
 
+/******************************************************************************/
+/* TYPE CACHE                                                                 */
+/******************************************************************************/
+
+template<typename T>
+struct TypeCache
+{
+    static std::atomic<const Type*> type;
+};
+
+template<typename T>
+std::atomic<const Type*> TypeCache<T>::type(nullptr);
+
+
+/******************************************************************************/
+/* TYPE RECORD                                                                */
+/******************************************************************************/
+
+struct TypeRecord
+{
+    const char* id;
+    void (*loader)(Type*);
+};
+
+
+/******************************************************************************/
+/* MEMORY REPORT                                                              */
+/******************************************************************************/
+
+enum class MetaCategory { Types, Functions, Fields, Traits, Scopes };
+
+struct MemoryReport
+{
+    size_t types;
+    size_t functions;
+    size_t fields;
+    size_t traits;
+    size_t scopes;
+
+    // Bytes reserved by the arena which includes fragmentation and memory
+    // released by the containers that can't be reused.
+    size_t reserved;
+
+    size_t total() const { return types + functions + fields + traits + scopes; }
+};
+
+
+/******************************************************************************/
+/* LOAD STATS                                                                 */
+/******************************************************************************/
+
+struct LoadStats
+{
+    std::string id;
+
+    // Wall time in seconds spent in the type's own loader. Time spent loading
+    // or waiting on dependencies is excluded as they get their own stats.
+    double elapsed;
+};
+
+
 /******************************************************************************/
 /* REGISTRY                                                                   */
 /******************************************************************************/
@@ -33,12 +135,20 @@ struct Registry
     {
         typedef typename CleanType<T>::type CleanT;
 
+        auto& cache = TypeCache<CleanT>::type;
+        const Type* type = cache.load(std::memory_order_acquire);
+        if (type) return type;
+
         Reflect<CleanT>::loader();
-        return get(Reflect<CleanT>::id());
+        return get(Reflect<CleanT>::id(), cache);
     }
 
     static const Type* get(const std::string& id);
 
+    // Same as get(id) but also stores the type in cache if it's fully loaded.
+    static const Type* get(
+            const std::string& id, std::atomic<const Type*>& cache);
+
     template<typename T>
     static void add()
     {
@@ -49,6 +159,9 @@ struct Registry
     }
     static void add(const std::string& id, std::function<void(Type*)> loader);
 
+    // Registers a range of records which are indexed on the next lookup.
+    static void add(const TypeRecord* first, const TypeRecord* last);
+
     template<typename T>
     static void alias(const std::string& alias)
     {
@@ -60,11 +173,111 @@ struct Registry
 
     static Scope* globalScope();
 
-private:
-    static void add(const std::string& id, const Type* type);
-    static const Type* load(const std::string& id);
+    // Runs all pending loaders whose id starts with prefix on the given number
+    // of threads (0 picks the hardware concurrency) and returns how long each
+    // type loaded in the meantime took, including dependencies outside of the
+    // prefix. Loaders registered while preloading are also run.
+    static std::vector<LoadStats> preload(
+            const std::string& prefix = "", size_t threads = 0);
+
+    // Metadata arena. Memory is never reused but deallocations are tracked
+    // so that the report reflects what's actually in use.
+    static void* allocate(MetaCategory category, size_t size, size_t align);
+    static void deallocate(MetaCategory category, size_t size);
+    static MemoryReport memoryReport();
+
+    // True if the calling thread is currently running a loader.
+    static bool isLoading();
+};
+
+
+/******************************************************************************/
+/* META ALLOCATOR                                                             */
+/******************************************************************************/
+
+/** Allocator for the containers of the reflection metadata. Only containers
+    constructed while a loader is running belong to the registry and are
+    allocated from its arena. Everything else, including copies handed out to
+    users, goes through the regular heap so that transient objects don't grow
+    the arena which never reuses memory.
+ */
+template<typename T, MetaCategory Category>
+struct MetaAllocator
+{
+    typedef T value_type;
+
+    // Memory must always be released to the allocator that provided it.
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    template<typename U>
+    struct rebind { typedef MetaAllocator<U, Category> other; };
+
+    MetaAllocator() : meta(Registry::isLoading()) {}
+
+    template<typename U>
+    MetaAllocator(const MetaAllocator<U, Category>& other) : meta(other.meta) {}
+
+    // Copies pick their allocator based on where they're made.
+    MetaAllocator select_on_container_copy_construction() const
+    {
+        return MetaAllocator();
+    }
+
+    T* allocate(size_t n)
+    {
+        if (!meta) return std::allocator<T>().allocate(n);
+
+        void* ptr = Registry::allocate(Category, n * sizeof(T), alignof(T));
+        return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* ptr, size_t n)
+    {
+        if (!meta) std::allocator<T>().deallocate(ptr, n);
+        else Registry::deallocate(Category, n * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const MetaAllocator<U, Category>& other) const
+    {
+        return meta == other.meta;
+    }
+
+    template<typename U>
+    bool operator!=(const MetaAllocator<U, Category>& other) const
+    {
+        return meta != other.meta;
+    }
+
+    bool meta;
 };
 
+template<typename K, typename V, MetaCategory Category>
+using MetaMap = std::unordered_map<K, V,
+      std::hash<K>, std::equal_to<K>,
+      MetaAllocator<std::pair<const K, V>, Category> >;
+
+template<typename T, MetaCategory Category>
+using MetaVector = std::vector<T, MetaAllocator<T, Category> >;
+
+
+/******************************************************************************/
+/* TYPE RECORDS                                                               */
+/******************************************************************************/
+
+// Hidden so that each shared object gets its own instance which registers the
+// records of its reflect_types section.
+template<typename T = void>
+struct reflectHidden TypeRecords
+{
+    TypeRecords() { Registry::add(__start_reflect_types, __stop_reflect_types); }
+    static TypeRecords registrar;
+};
+
+template<typename T>
+TypeRecords<T> TypeRecords<T>::registrar;
+
 
 /******************************************************************************/
 /* TYPE ID                                                                    */
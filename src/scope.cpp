@@ -121,7 +121,7 @@ print(int indent) const
         ss << pad1 << Traits::print() << "\n";
 
     for (auto& fn : functions_) {
-        ss << pad1 << fn.first << ":\n";
+        ss << pad1 << fn.first.str() << ":\n";
         ss << fn.second.print(indent + PadInc);
     }
 
@@ -129,7 +129,7 @@ print(int indent) const
         ss << pad0 << "\n";
 
     for (auto& type : types_)
-        ss << pad1 << "type " << type.first << ";\n";
+        ss << pad1 << "type " << type.first.str() << ";\n";
 
     if (!types_.empty() && !scopes_.empty()) ss << pad0 << "\n";
 
@@ -154,7 +154,7 @@ scopes() const
     result.reserve(scopes_.size());
 
     for(auto& scope : scopes_)
-        result.push_back(scope.first);
+        result.push_back(scope.first.str());
 
     return result;
 }
@@ -165,7 +165,7 @@ hasScope(const std::string& name) const
 {
     auto split = head(name);
 
-    auto it = scopes_.find(split.first);
+    auto it = scopes_.find(Symbol::find(split.first));
     if (it == scopes_.end()) return false;
 
     return !split.second.empty() ? it->second->hasScope(split.second) : true;
@@ -177,7 +177,7 @@ scope(const std::string& name) const
 {
     auto split = head(name);
 
-    auto it = scopes_.find(split.first);
+    auto it = scopes_.find(Symbol::find(split.first));
     if (it == scopes_.end())
         reflectError("<%s> doesn't have scope <%s>", name_, name);
 
@@ -190,10 +190,13 @@ scope(const std::string& name)
 {
     auto split = head(name);
 
-    auto it = scopes_.find(split.first);
+    Symbol symbol(split.first);
+
+    auto it = scopes_.find(symbol);
     if (it == scopes_.end()) {
-        std::unique_ptr<Scope> scope(new Scope(split.first, this));
-        it = scopes_.emplace(split.first, scope.release()).first;
+        void* ptr = Registry::allocate(
+                MetaCategory::Scopes, sizeof(Scope), alignof(Scope));
+        it = scopes_.emplace(symbol, new (ptr) Scope(split.first, this)).first;
     }
 
     return !split.second.empty() ? it->second->scope(split.second) : it->second;
@@ -212,7 +215,7 @@ types(bool includeScopes) const
     result.reserve(types_.size());
 
     for(auto& type : types_)
-        result.push_back(type.first);
+        result.push_back(type.first.str());
 
     if (!includeScopes) return result;
 
@@ -221,7 +224,7 @@ types(bool includeScopes) const
         result.reserve(result.size() + scopeTypes.size());
 
         for (auto& type : scopeTypes)
-            result.emplace_back(join(scope.first, type));
+            result.emplace_back(join(scope.first.str(), type));
     }
 
     return result;
@@ -233,11 +236,13 @@ hasType(const std::string& name)
 {
     auto split = head(name);
 
-    auto it = types_.find(split.first);
+    Symbol symbol = Symbol::find(split.first);
+
+    auto it = types_.find(symbol);
     if (it == types_.end()) {
         if (split.second.empty()) return false;
 
-        auto scopeIt = scopes_.find(split.first);
+        auto scopeIt = scopes_.find(symbol);
         if (scopeIt == scopes_.end()) return false;
 
         return scopeIt->second->hasType(split.second);
@@ -255,10 +260,12 @@ type(const std::string& name)
 {
     auto split = head(name);
 
-    auto it = types_.find(split.first);
+    Symbol symbol = Symbol::find(split.first);
+
+    auto it = types_.find(symbol);
     if (it == types_.end()) {
 
-        auto scopeIt = scopes_.find(split.first);
+        auto scopeIt = scopes_.find(symbol);
         if (split.second.empty() || scopeIt == scopes_.end())
             reflectError("unknown type <%s::%s>", id(), split.first);
 
@@ -284,15 +291,17 @@ addType(const std::string& name)
 
     if (split.second.empty()) {
         // The type is added before it's loaded so we'll lazy loaded as needed.
-        types_.emplace(split.first, nullptr);
+        types_.emplace(Symbol(split.first), nullptr);
         return;
     }
 
-    auto typeIt = types_.find(split.first);
+    Symbol symbol(split.first);
+
+    auto typeIt = types_.find(symbol);
     if (typeIt != types_.end())
         reflectError("Type doesn't support inner classes yet");
 
-    auto fnIt = functions_.find(split.first);
+    auto fnIt = functions_.find(symbol);
     if (fnIt != functions_.end())
         reflectError("<%s> conflicts with function in <%s>", name, id());
 
@@ -313,7 +322,7 @@ addFunction(const std::string& name, Function&& fn)
     if (!split.second.empty())
         return scope(split.second)->addFunction(split.first, std::move(fn));
 
-    functions_[split.first].add(std::move(fn));
+    functions_[Symbol(split.first)].add(std::move(fn));
 }
 
 std::vector<std::string>
@@ -324,7 +333,7 @@ functions(bool includeScopes) const
     result.reserve(types_.size());
 
     for(auto& function : functions_)
-        result.push_back(function.first);
+        result.push_back(function.first.str());
 
     if (!includeScopes) return result;
 
@@ -333,7 +342,7 @@ functions(bool includeScopes) const
         result.reserve(result.size() + scopeFunctions.size());
 
         for (auto& fn : scopeFunctions)
-            result.emplace_back(join(scope.first, fn));
+            result.emplace_back(join(scope.first.str(), fn));
     }
 
     return result;
@@ -348,8 +357,14 @@ hasFunction(const std::string& name) const
     if (!split.second.empty())
         return scope(split.second)->hasFunction(split.first);
 
-    auto it = functions_.find(split.first);
-    return it != functions_.end();
+    return hasFunction(Symbol::find(split.first));
+}
+
+bool
+Scope::
+hasFunction(Symbol name) const
+{
+    return functions_.count(name);
 }
 
 Overloads&
@@ -361,13 +376,24 @@ function(const std::string& name)
     if (!split.second.empty())
         return scope(split.second)->function(split.first);
 
-    auto it = functions_.find(split.first);
+    auto it = functions_.find(Symbol::find(split.first));
     if (it == functions_.end())
         reflectError("<%s> has no function <%s>", id(), split.first);
 
     return it->second;
 }
 
+Overloads&
+Scope::
+function(Symbol name)
+{
+    auto it = functions_.find(name);
+    if (it == functions_.end())
+        reflectError("<%s> has no function <%s>", id(), name.str());
+
+    return it->second;
+}
+
 const Overloads&
 Scope::
 function(const std::string& name) const
@@ -375,4 +401,11 @@ function(const std::string& name) const
     return const_cast<Scope*>(this)->function(name);
 }
 
+const Overloads&
+Scope::
+function(Symbol name) const
+{
+    return const_cast<Scope*>(this)->function(name);
+}
+
 } // reflect
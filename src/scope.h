@@ -47,12 +47,18 @@ struct Scope : public Traits
 
     std::vector<std::string> functions(bool includeScopes = false) const;
     bool hasFunction(const std::string& name) const;
+    bool hasFunction(Symbol name) const;
     Overloads& function(const std::string& name);
+    Overloads& function(Symbol name);
     const Overloads& function(const std::string& name) const;
+    const Overloads& function(Symbol name) const;
 
     template<typename Ret, typename... Args>
     Ret call(const std::string& fn, Args&&... args) const;
 
+    template<typename Ret, typename... Args>
+    Ret call(Symbol fn, Args&&... args) const;
+
     std::string print(int indent = 0) const;
 
     static std::string join(const std::string& head, const std::string& tail);
@@ -64,10 +70,13 @@ private:
     std::string name_;
 
     Scope* parent_;
-    std::unordered_map<std::string, Scope*> scopes_;
+    template<typename V>
+    using Map = MetaMap<Symbol, V, MetaCategory::Scopes>;
+
+    Map<Scope*> scopes_;
 
-    std::unordered_map<std::string, const Type*> types_;
-    std::unordered_map<std::string, Overloads> functions_;
+    Map<const Type*> types_;
+    Map<Overloads> functions_;
 };
 
 } // reflect
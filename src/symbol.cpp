@@ -0,0 +1,105 @@
+/* symbol.cpp                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Symbol intern table.
+*/
+
+#include "reflect.h"
+
+#include <mutex>
+
+namespace reflect {
+
+/******************************************************************************/
+/* SYMBOL TABLE                                                               */
+/******************************************************************************/
+
+namespace {
+
+struct SymbolNode
+{
+    SymbolNode(std::string str, size_t hash) :
+        str(std::move(str)), hash(hash)
+    {}
+
+    const std::string str;
+    const size_t hash;
+};
+
+struct SymbolTable
+{
+    SymbolTable() : nodes(1024) {}
+
+    const SymbolNode* find(const std::string& str, size_t hash) const
+    {
+        return nodes.find(str, hash);
+    }
+
+    const SymbolNode* intern(const std::string& str)
+    {
+        size_t hash = std::hash<std::string>()(str);
+        if (auto node = find(str, hash)) return node;
+
+        std::lock_guard<std::mutex> guard(lock);
+        if (auto node = find(str, hash)) return node;
+
+        auto node = new SymbolNode(str, hash);
+        nodes.insert(node);
+        return node;
+    }
+
+    std::mutex lock;
+    InsertTable<SymbolNode, &SymbolNode::str> nodes;
+};
+
+// Symbols can be created by static constructors so the table is lazily
+// initialized.
+std::atomic<SymbolTable*> symbols_;
+
+SymbolTable& getSymbols()
+{
+    SymbolTable* symbols = symbols_.load(std::memory_order_acquire);
+    if (symbols) return *symbols;
+
+    std::unique_ptr<SymbolTable> table(new SymbolTable());
+    if (symbols_.compare_exchange_strong(symbols, table.get()))
+        return *table.release();
+    return *symbols;
+}
+
+} // namespace anonymous
+
+
+/******************************************************************************/
+/* SYMBOL                                                                     */
+/******************************************************************************/
+
+Symbol::
+Symbol(const char* str) :
+    str_(&getSymbols().intern(str)->str)
+{}
+
+Symbol::
+Symbol(const std::string& str) :
+    str_(&getSymbols().intern(str)->str)
+{}
+
+Symbol
+Symbol::
+find(const std::string& str)
+{
+    size_t hash = std::hash<std::string>()(str);
+    auto node = getSymbols().find(str, hash);
+    return node ? Symbol(&node->str) : Symbol();
+}
+
+const std::string&
+Symbol::
+str() const
+{
+    static const std::string empty;
+    return str_ ? *str_ : empty;
+}
+
+} // namespace reflect
@@ -0,0 +1,61 @@
+/* symbol.h                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Interned strings used to name functions, fields, traits and scopes.
+
+   A symbol is a pointer into a global intern table which means that comparing
+   and hashing symbols never touches the underlying string. Creating a symbol
+   interns its string and symbols are never freed so they're meant to be
+   created once and reused for repeated lookups.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* SYMBOL                                                                     */
+/******************************************************************************/
+
+struct Symbol
+{
+    Symbol() : str_(nullptr) {}
+    explicit Symbol(const char* str);
+    explicit Symbol(const std::string& str);
+
+    // Returns the null symbol if the string was never interned. Useful for
+    // lookups which shouldn't grow the intern table.
+    static Symbol find(const std::string& str);
+
+    explicit operator bool() const { return str_; }
+
+    const std::string& str() const;
+    size_t hash() const { return std::hash<const std::string*>()(str_); }
+
+    bool operator==(Symbol other) const { return str_ == other.str_; }
+    bool operator!=(Symbol other) const { return str_ != other.str_; }
+
+private:
+    explicit Symbol(const std::string* str) : str_(str) {}
+
+    const std::string* str_;
+};
+
+} // namespace reflect
+
+
+/******************************************************************************/
+/* HASH                                                                       */
+/******************************************************************************/
+
+namespace std {
+
+template<>
+struct hash<reflect::Symbol>
+{
+    size_t operator() (reflect::Symbol symbol) const { return symbol.hash(); }
+};
+
+} // namespace std
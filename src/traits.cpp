@@ -17,10 +17,11 @@ void
 Traits::
 addTrait(const std::string& trait, Value value)
 {
-    if (traits_.count(trait))
+    Symbol symbol(trait);
+    if (traits_.count(symbol))
         reflectError("trait <%s> already exists", trait);
 
-    traits_[trait] = std::move(value);
+    traits_[symbol] = std::move(value);
 }
 
 std::vector<std::string>
@@ -31,7 +32,7 @@ traits() const
     result.reserve(traits_.size());
 
     for (const auto& trait : traits_)
-        result.push_back(trait.first);
+        result.push_back(trait.first.str());
 
     return result;
 }
@@ -39,6 +40,13 @@ traits() const
 bool
 Traits::
 is(const std::string& trait) const
+{
+    return is(Symbol::find(trait));
+}
+
+bool
+Traits::
+is(Symbol trait) const
 {
     return traits_.count(trait);
 }
@@ -51,7 +59,7 @@ print() const
 
     ss << "[ ";
     for (const auto& trait : traits_)
-        ss << trait.first << " ";
+        ss << trait.first.str() << " ";
     ss << "]";
 
     return ss.str();
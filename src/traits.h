@@ -23,6 +23,7 @@ struct Traits
     std::vector<std::string> traits() const;
 
     bool is(const std::string& trait) const;
+    bool is(Symbol trait) const;
 
     template<typename Ret>
     Ret getValue(const std::string& trait) const;
@@ -32,7 +33,7 @@ protected:
     std::string print() const;
 
 private:
-    std::unordered_map<std::string, Value> traits_;
+    MetaMap<Symbol, Value, MetaCategory::Traits> traits_;
 };
 
 } // namespace reflect
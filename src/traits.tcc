@@ -27,7 +27,7 @@ Ret
 Traits::
 getValue(const std::string& trait) const
 {
-    auto it = traits_.find(trait);
+    auto it = traits_.find(Symbol::find(trait));
     if (it != traits_.end())
         return retCast<Ret>(it->second);
 
@@ -18,18 +18,146 @@ namespace reflect {
 
 Type::
 Type(std::string id) :
-    id_(std::move(id)), parent_(nullptr), pointee_(nullptr)
+    id_(std::move(id)), parent_(nullptr), pointee_(nullptr),
+    depth_(0), tables_(nullptr), finalizing_(false),
+    copiable_(FlagUnknown), movable_(FlagUnknown)
 {}
 
+void
+Type::
+finalize()
+{
+    if (isFinalized()) return;
+
+    // Children register themselves so that they can be finalized along with
+    // their parent and kept up to date with its changes.
+    if (parent_) {
+        std::lock_guard<std::mutex> guard(parent_->lock_);
+
+        auto& siblings = parent_->children_;
+        if (std::find(siblings.begin(), siblings.end(), this) == siblings.end())
+            siblings.push_back(this);
+
+        if (!parent_->isFinalized()) return;
+    }
+
+    // A child can be finalized by both its loader and its parent.
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (finalizing_) return;
+        finalizing_ = true;
+    }
+
+    if (parent_) ancestors_ = parent_->ancestors_;
+    depth_ = ancestors_.size();
+    ancestors_.push_back(this);
+
+    merge();
+
+    // Updates to our parent skip us until we're finalized so we have to catch
+    // up on any that came in while we were merging. Reading the parent's
+    // tables under its lock orders us with its walk over its children.
+    while (parent_) {
+        const Tables* inherited;
+        {
+            std::lock_guard<std::mutex> guard(parent_->lock_);
+            inherited = parent_->tables_.load(std::memory_order_acquire);
+        }
+
+        if (tables_.load(std::memory_order_acquire)->inherited == inherited)
+            break;
+        merge();
+    }
+
+    for (Type* child : children()) child->finalize();
+}
+
+// Changes to a finalized type need to be reflected in the tables of all the
+// types that inherited them.
+void
+Type::
+update()
+{
+    merge();
+
+    for (Type* child : children()) {
+        if (child->isFinalized()) child->update();
+    }
+}
+
+// Builds a new set of tables on the side and publishes it once complete which
+// also marks the type as finalized the first time around. The lock ensures
+// that a concurrent merge can't publish older tables over ours.
+void
+Type::
+merge()
+{
+    std::unique_ptr<Tables> tables(new Tables);
+    std::lock_guard<std::mutex> guard(lock_);
+
+    if (parent_) {
+        auto inherited = parent_->tables_.load(std::memory_order_acquire);
+        tables->inherited = inherited;
+        tables->fns = inherited->fns;
+        tables->fields = inherited->fields;
+        tables->converters = inherited->converters;
+    }
+
+    for (const auto& fn : fns_) tables->fns[fn.first] = &fn.second;
+    for (const auto& field : fields_)
+        tables->fields[field.first] = &field.second;
+    for (const auto& fns : converters_)
+        tables->converters[fns.first] = fns.second;
+
+    freeze(*tables);
+
+    tables_.store(tables.get(), std::memory_order_release);
+    allTables_.push_back(std::move(tables));
+}
+
+std::vector<Type*>
+Type::
+children() const
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    return std::vector<Type*>(children_.begin(), children_.end());
+}
+
+namespace {
+
+template<typename Index, typename Table>
+void freezeTable(Index& index, const Table& table)
+{
+    typedef typename Table::mapped_type Value;
+
+    std::vector< std::pair<Symbol, Value> > items(table.begin(), table.end());
+    index.build(items);
+}
+
+} // namespace anonymous
+
+void
+Type::
+freeze(Tables& tables)
+{
+    freezeTable(tables.fnIndex, tables.fns);
+    freezeTable(tables.fieldIndex, tables.fields);
+}
+
 bool
 Type::
 isChildOf(const Type* other) const
 {
     if (this == other) return true;
 
-    if (isPointer() && other->isPointer()) {
-        if (pointer() != other->pointer()) return false;
-        return pointee()->isChildOf(other->pointee());
+    if (pointer_ && other->pointer_) {
+        if (pointer_ != other->pointer_) return false;
+        return pointee_->isChildOf(other->pointee_);
+    }
+
+    if (isFinalized() && other->isFinalized()) {
+        return other->depth_ <= depth_
+            && ancestors_[other->depth_] == other;
     }
 
     return parent_ && parent_->isChildOf(other);
@@ -42,62 +170,120 @@ isParentOf(const Type* other) const
     return other->isChildOf(this);
 }
 
+// Converters are named after the id of their target type which we check
+// against the return type of the function so that we can index them by type.
+void
+Type::
+addConverter(const std::string& name, const Overloads& fns)
+{
+    static const std::string prefix = "operator ";
+    static const std::string suffix = "()";
+
+    if (name.size() <= prefix.size() + suffix.size()) return;
+    if (name.compare(0, prefix.size(), prefix)) return;
+    if (name.compare(name.size() - suffix.size(), suffix.size(), suffix))
+        return;
+
+    const Type* target = fns[fns.size() - 1].returnType().type();
+    if (name != prefix + target->id() + suffix) return;
+
+    converters_[target] = &fns;
+
+    if (isFinalized() && findConverter(target) != &fns) update();
+}
+
+const Overloads*
+Type::
+findConverter(const Type* other) const
+{
+    if (const Tables* tables = tables_.load(std::memory_order_acquire)) {
+        auto it = tables->converters.find(other);
+        return it != tables->converters.end() ? it->second : nullptr;
+    }
+
+    auto it = converters_.find(other);
+    if (it != converters_.end()) return it->second;
+    return parent_ ? parent_->findConverter(other) : nullptr;
+}
+
 bool
 Type::
 hasConverter(const Type* other) const
 {
-    return hasFunction("operator " + other->id() + "()");
+    return findConverter(other);
 }
 
 const Function&
 Type::
 converter(const Type* other) const
 {
-    auto& fns = function("operator " + other->id() + "()");
+    auto fns = findConverter(other);
+    if (!fns)
+        reflectError("<%s> has no converters for <%s>", id_, other->id());
 
-    if (fns.size() > 1) {
+    if (fns->size() > 1) {
         reflectError("<%s> has too many converters for <%s>",
                 id_, other->id());
     }
 
-    return fns[0];
+    return (*fns)[0];
 }
 
 bool
 Type::
-isCopiable() const
+isConstructible(std::atomic<int>& cache, RefType refType) const
 {
-    if (!hasFunction(id_)) return false;
+    int flag = cache.load(std::memory_order_relaxed);
+    if (flag != FlagUnknown) return flag == FlagTrue;
 
-    auto& fns = function(id_);
-    return fns.test(
+    auto fns = findFunction(Symbol::find(id_));
+    bool result = fns && fns->test(
             Argument(this, RefType::Copy, false),
-            { Argument(this, RefType::Copy, false) });
+            { Argument(this, refType, false) });
+
+    // Constructors can still be added to types that are being loaded.
+    if (isFinalized())
+        cache.store(result ? FlagTrue : FlagFalse, std::memory_order_relaxed);
+
+    return result;
 }
 
 bool
 Type::
-isMovable() const
+isCopiable() const
 {
-    if (!hasFunction(id_)) return false;
+    return isConstructible(copiable_, RefType::Copy);
+}
 
-    auto& fns = function(id_);
-    return fns.test(
-            Argument(this, RefType::Copy, false),
-            { Argument(this, RefType::RValue, false) });
+bool
+Type::
+isMovable() const
+{
+    return isConstructible(movable_, RefType::RValue);
 }
 
 void
 Type::
 addFunction(const std::string& name, Function&& fn)
 {
-    auto it = fields_.find(name);
+    Symbol symbol(name);
+
+    auto it = fields_.find(symbol);
     if (it != fields_.end()) {
         reflectError("function <%s> already exists as field <%s> in <%s>",
                 name, it->second.print(), id());
     }
 
-    fns_[name].add(std::move(fn));
+    auto& overloads = fns_[symbol];
+    overloads.add(std::move(fn));
+
+    if (name == id_) {
+        copiable_.store(FlagUnknown, std::memory_order_relaxed);
+        movable_.store(FlagUnknown, std::memory_order_relaxed);
+    }
+    else addConverter(name, overloads);
+
+    if (isFinalized() && findFunction(symbol) != &overloads) update();
 }
 
 void
@@ -107,7 +293,7 @@ functions(std::vector<std::string>& result) const
     result.reserve(result.size() + fns_.size());
 
     for (const auto& f : fns_)
-        result.push_back(f.first);
+        result.push_back(f.first.str());
 
     if (parent_) parent_->functions(result);
 }
@@ -125,53 +311,130 @@ functions() const
     return result;
 }
 
+const Overloads*
+Type::
+findFunction(Symbol fn) const
+{
+    if (const Tables* tables = tables_.load(std::memory_order_acquire)) {
+        auto it = tables->fns.find(fn);
+        return it != tables->fns.end() ? it->second : nullptr;
+    }
+
+    auto it = fns_.find(fn);
+    if (it != fns_.end()) return &it->second;
+    return parent_ ? parent_->findFunction(fn) : nullptr;
+}
+
+// Frozen tables only fail to build if we can't find a perfect hash in which
+// case we fall back to the symbol tables.
+const Overloads*
+Type::
+findFunction(const char* fn, size_t len) const
+{
+    const Tables* tables = tables_.load(std::memory_order_acquire);
+    if (tables && tables->fnIndex.size() == tables->fns.size()) {
+        auto result = tables->fnIndex.find(fn, len);
+        return result ? *result : nullptr;
+    }
+
+    return findFunction(Symbol::find(std::string(fn, len)));
+}
+
 bool
 Type::
 hasFunction(const std::string& fn) const
 {
-    if (fns_.count(fn)) return true;
-    return parent_ ? parent_->hasFunction(fn) : false;
+    return findFunction(fn.data(), fn.size());
+}
+
+bool
+Type::
+hasFunction(const char* fn, size_t len) const
+{
+    return findFunction(fn, len);
+}
+
+bool
+Type::
+hasFunction(Symbol fn) const
+{
+    return findFunction(fn);
 }
 
 Overloads&
 Type::
 function(const std::string& fn)
 {
-    auto it = fns_.find(fn);
+    auto it = fns_.find(Symbol::find(fn));
     if (it == fns_.end())
         reflectError("<%s> doesn't have an immediate function <%s>", id_, fn);
 
     return it->second;
 }
 
+Overloads&
+Type::
+function(Symbol fn)
+{
+    auto it = fns_.find(fn);
+    if (it == fns_.end()) {
+        reflectError("<%s> doesn't have an immediate function <%s>",
+                id_, fn.str());
+    }
+
+    return it->second;
+}
+
 const Overloads&
 Type::
 function(const std::string& fn) const
 {
-    auto it = fns_.find(fn);
-    if (it != fns_.end()) return it->second;
+    return function(fn.data(), fn.size());
+}
 
-    if (!parent_)
-        reflectError("<%s> doesn't have a function <%s>", id_, fn);
+const Overloads&
+Type::
+function(const char* fn, size_t len) const
+{
+    auto overloads = findFunction(fn, len);
+    if (!overloads) {
+        reflectError("<%s> doesn't have a function <%s>",
+                id_, std::string(fn, len));
+    }
 
-    return parent_->function(fn);
+    return *overloads;
+}
+
+const Overloads&
+Type::
+function(Symbol fn) const
+{
+    auto overloads = findFunction(fn);
+    if (!overloads)
+        reflectError("<%s> doesn't have a function <%s>", id_, fn.str());
+
+    return *overloads;
 }
 
 void
 Type::
 addField(const std::string& name, Field&& field)
 {
-    auto it = fns_.find(name);
+    Symbol symbol(name);
+
+    auto it = fns_.find(symbol);
     if (it != fns_.end()) {
         reflectError("field <%s> already exists as function <%s> in <%s>",
                 field.print(), it->second.print(), id());
     }
 
-    auto ret = fields_.emplace(name, std::move(field));
+    auto ret = fields_.emplace(symbol, std::move(field));
     if (!ret.second) {
         reflectError("field <%s> already exists as field <%s> in <%s>",
                 field.print(), ret.first->second.print(), id());
     }
+
+    if (isFinalized()) update();
 }
 
 void
@@ -181,7 +444,7 @@ fields(std::vector<std::string>& result) const
     result.reserve(result.size() + fields_.size());
 
     for (const auto& field : fields_)
-        result.push_back(field.first);
+        result.push_back(field.first.str());
 
     if (parent_) parent_->fields(result);
 }
@@ -199,43 +462,114 @@ fields() const
     return result;
 }
 
+const Field*
+Type::
+findField(Symbol field) const
+{
+    if (const Tables* tables = tables_.load(std::memory_order_acquire)) {
+        auto it = tables->fields.find(field);
+        return it != tables->fields.end() ? it->second : nullptr;
+    }
+
+    auto it = fields_.find(field);
+    if (it != fields_.end()) return &it->second;
+    return parent_ ? parent_->findField(field) : nullptr;
+}
+
+const Field*
+Type::
+findField(const char* field, size_t len) const
+{
+    const Tables* tables = tables_.load(std::memory_order_acquire);
+    if (tables && tables->fieldIndex.size() == tables->fields.size()) {
+        auto result = tables->fieldIndex.find(field, len);
+        return result ? *result : nullptr;
+    }
+
+    return findField(Symbol::find(std::string(field, len)));
+}
+
 bool
 Type::
 hasField(const std::string& field) const
 {
-    if (fields_.count(field)) return true;
-    return parent_ ? parent_->hasField(field) : false;
+    return findField(field.data(), field.size());
+}
+
+bool
+Type::
+hasField(const char* field, size_t len) const
+{
+    return findField(field, len);
+}
+
+bool
+Type::
+hasField(Symbol field) const
+{
+    return findField(field);
 }
 
 Field&
 Type::
 field(const std::string& field)
 {
-    auto it = fields_.find(field);
+    auto it = fields_.find(Symbol::find(field));
     if (it == fields_.end())
         reflectError("<%s> doesn't have an immediate field <%s>", id_, field);
 
     return it->second;
 }
 
+Field&
+Type::
+field(Symbol field)
+{
+    auto it = fields_.find(field);
+    if (it == fields_.end()) {
+        reflectError("<%s> doesn't have an immediate field <%s>",
+                id_, field.str());
+    }
+
+    return it->second;
+}
+
 const Field&
 Type::
 field(const std::string& field) const
 {
-    auto it = fields_.find(field);
-    if (it != fields_.end()) return it->second;
+    return this->field(field.data(), field.size());
+}
 
-    if (!parent_)
-        reflectError("<%s> doesn't have a field <%s>", id_, field);
+const Field&
+Type::
+field(const char* field, size_t len) const
+{
+    auto result = findField(field, len);
+    if (!result) {
+        reflectError("<%s> doesn't have a field <%s>",
+                id_, std::string(field, len));
+    }
+
+    return *result;
+}
+
+const Field&
+Type::
+field(Symbol field) const
+{
+    auto result = findField(field);
+    if (!result)
+        reflectError("<%s> doesn't have a field <%s>", id_, field.str());
 
-    return parent_->field(field);
+    return *result;
 }
 
 bool
 Type::
 isPointer() const
 {
-    return is("pointer");
+    return !!pointer_;
 }
 
 std::string
@@ -243,7 +577,7 @@ Type::
 pointer() const
 {
     if (!isPointer()) reflectError("<%s> is not a pointer", id());
-    return pointer_;
+    return pointer_.str();
 }
 
 const Type*
@@ -261,7 +595,7 @@ setPointer(std::string pointer, const Type* pointee)
     if (isPointer()) reflectError("<%s> is already a pointer", id());
 
     addTrait("pointer");
-    pointer_ = std::move(pointer);
+    pointer_ = Symbol(pointer);
     pointee_ = pointee;
 }
 
@@ -274,8 +608,8 @@ alloc() const
 
 namespace  {
 
-std::vector<const Field*>
-sortedFields(const std::unordered_map<std::string, Field>& fields)
+template<typename Fields>
+std::vector<const Field*> sortedFields(const Fields& fields)
 {
     std::vector<const Field*> result;
     result.reserve(fields.size());
@@ -328,7 +662,7 @@ print(size_t indent) const
 
     sep(!fns_.empty());
     for (const auto& fn : fns_) {
-        ss << pad1 << fn.first << ":\n";
+        ss << pad1 << fn.first.str() << ":\n";
         ss << fn.second.print(indent + PadInc);
     }
 
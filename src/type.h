@@ -3,6 +3,21 @@
    FreeBSD-style copyright and disclaimer apply
 
    Type of a type.
+
+   Once its loader completes, a type is finalized by the registry which merges
+   its own and its inherited functions and fields into a single table and
+   records its ancestors by depth so that isChildOf is a single indexed
+   compare. Types whose parent isn't finalized yet (recursive loads) fall back
+   to walking the parent chain until they're finalized along with their parent.
+   Members added to a finalized type are merged into new tables for the type
+   and its finalized descendants which are then swapped in without blocking
+   lookups. Members must still be added by one thread at a time.
+
+   Converters are indexed by their target type as they're added and the
+   copiable and movable flags are cached once the type is finalized.
+
+   Finalizing also freezes the merged member tables into minimal perfect hash
+   tables so that lookups by name are a single hash and compare.
 */
 
 #include "reflect.h"
@@ -33,8 +48,13 @@ struct Type : public Traits
 
     std::vector<std::string> functions() const;
     bool hasFunction(const std::string& fn) const;
+    bool hasFunction(const char* fn, size_t len) const;
+    bool hasFunction(Symbol fn) const;
     Overloads& function(const std::string& fn);
+    Overloads& function(Symbol fn);
     const Overloads& function(const std::string& fn) const;
+    const Overloads& function(const char* fn, size_t len) const;
+    const Overloads& function(Symbol fn) const;
 
     template<typename T>
     void addField(const std::string& name, size_t offset);
@@ -42,14 +62,26 @@ struct Type : public Traits
 
     std::vector<std::string> fields() const;
     bool hasField(const std::string& field) const;
+    bool hasField(const char* field, size_t len) const;
+    bool hasField(Symbol field) const;
     Field& field(const std::string& field);
+    Field& field(Symbol field);
     const Field& field(const std::string& field) const;
+    const Field& field(const char* field, size_t len) const;
+    const Field& field(Symbol field) const;
 
     bool isPointer() const;
     std::string pointer() const;
     const Type* pointee() const;
     void setPointer(std::string pointer, const Type* pointee);
 
+    // Called by the registry once the type's loader has completed.
+    void finalize();
+    bool isFinalized() const
+    {
+        return tables_.load(std::memory_order_acquire);
+    }
+
     template<typename T>
     bool isParentOf() const { return isParentOf(type<T>()); }
     bool isParentOf(const Type* other) const;
@@ -76,6 +108,9 @@ struct Type : public Traits
     template<typename Ret, typename... Args>
     Ret call(const std::string& fn, Args&&... args) const;
 
+    template<typename Ret, typename... Args>
+    Ret call(Symbol fn, Args&&... args) const;
+
     std::string print(size_t indent = 0) const;
 
 private:
@@ -83,14 +118,72 @@ private:
     void functions(std::vector<std::string>& result) const;
     void fields(std::vector<std::string>& result) const;
 
+    const Overloads* findFunction(Symbol fn) const;
+    const Overloads* findFunction(const char* fn, size_t len) const;
+    const Field* findField(Symbol field) const;
+    const Field* findField(const char* field, size_t len) const;
+    struct Tables;
+
+    void merge();
+    void update();
+    static void freeze(Tables& tables);
+    std::vector<Type*> children() const;
+    const Overloads* findConverter(const Type* other) const;
+
+    void addConverter(const std::string& name, const Overloads& fns);
+    bool isConstructible(std::atomic<int>& cache, RefType refType) const;
+
     std::string id_;
     const Type* parent_;
 
-    std::string pointer_;
+    Symbol pointer_;
     const Type* pointee_;
 
-    std::unordered_map<std::string, Field> fields_;
-    std::unordered_map<std::string, Overloads> fns_;
+    typedef MetaMap<Symbol, Field, MetaCategory::Fields> Fields;
+    typedef MetaMap<Symbol, Overloads, MetaCategory::Functions> Functions;
+
+    template<typename K, typename V>
+    using Table = MetaMap<K, V, MetaCategory::Types>;
+
+    Fields fields_;
+    Functions fns_;
+
+    size_t depth_;
+    MetaVector<const Type*, MetaCategory::Types> ancestors_;
+
+    // Own and inherited members merged by finalize.
+    struct Tables
+    {
+        Tables() : inherited(nullptr) {}
+
+        // Tables of the parent that these were merged from.
+        const Tables* inherited;
+
+        Table<Symbol, const Overloads*> fns;
+        Table<Symbol, const Field*> fields;
+        Table<const Type*, const Overloads*> converters;
+
+        PerfectHash<const Overloads*> fnIndex;
+        PerfectHash<const Field*> fieldIndex;
+    };
+
+    // Set once the type is finalized and replaced whenever members are added.
+    // Replaced tables are kept alive as lookups could still be reading them.
+    std::atomic<const Tables*> tables_;
+    MetaVector<std::unique_ptr<Tables>, MetaCategory::Types> allTables_;
+
+    // Guards the fields below as well as allTables_.
+    mutable std::mutex lock_;
+    bool finalizing_;
+
+    // Types that inherit from this type and have been loaded.
+    mutable MetaVector<Type*, MetaCategory::Types> children_;
+
+    Table<const Type*, const Overloads*> converters_;
+
+    enum Flag { FlagUnknown = 0, FlagFalse, FlagTrue };
+    mutable std::atomic<int> copiable_;
+    mutable std::atomic<int> movable_;
 };
 
 
@@ -46,4 +46,12 @@ call(const std::string& fn, Args&&... args) const
     return function(fn).call<Ret>(std::forward<Args>(args)...);
 }
 
+template<typename Ret, typename... Args>
+Ret
+Type::
+call(Symbol fn, Args&&... args) const
+{
+    return function(fn).call<Ret>(std::forward<Args>(args)...);
+}
+
 } // namespace reflect
@@ -17,7 +17,11 @@ namespace reflect {
 /* TYPE VECTOR                                                                */
 /******************************************************************************/
 
-template<typename... T> struct TypeVector {};
+template<typename... T>
+struct TypeVector
+{
+    static constexpr size_t size = sizeof...(T);
+};
 
 
 /******************************************************************************/
@@ -44,4 +48,30 @@ struct RepeatType
 };
 
 
+/******************************************************************************/
+/* INDEX VECTOR                                                               */
+/******************************************************************************/
+
+template<size_t... I> struct IndexVector {};
+
+namespace details {
+
+template<size_t N, size_t... Pack>
+struct MakeIndexes : MakeIndexes<N-1, N-1, Pack...> {};
+
+template<size_t... Pack>
+struct MakeIndexes<0, Pack...>
+{
+    typedef IndexVector<Pack...> type;
+};
+
+} // namespace details
+
+template<size_t N>
+struct MakeIndexes
+{
+    typedef typename details::MakeIndexes<N>::type type;
+};
+
+
 } // reflect
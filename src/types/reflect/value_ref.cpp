@@ -0,0 +1,16 @@
+/* value_ref.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   reflect::ValueRef reflection implementation.
+*/
+
+#include "value_ref.h"
+
+/******************************************************************************/
+/* VALUE REF                                                                  */
+/******************************************************************************/
+
+reflectTypeImpl(reflect::ValueRef)
+{
+}
@@ -0,0 +1,16 @@
+/* value_ref.h                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Type for reflect::ValueRef.
+*/
+
+#pragma once
+
+#include "reflect.h"
+
+/******************************************************************************/
+/* REFLECT VALUE REF                                                          */
+/******************************************************************************/
+
+reflectTypeDecl(reflect::ValueRef)
@@ -54,5 +54,10 @@ namespace reflect {
 #define reflectUnused __attribute__((unused))
 #define reflectUnreachable() __builtin_unreachable()
 
+#define reflectUsed __attribute__((used))
+#define reflectWeak __attribute__((weak))
+#define reflectHidden __attribute__((visibility("hidden")))
+#define reflectSection(name) __attribute__((section(name)))
+
 
 } // reflect
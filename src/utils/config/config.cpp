@@ -103,10 +103,8 @@ link(const Path& link, const Path& target)
         return;
     }
 
-    Value value = it->second;
-    if (target.size() > 1)
-        value = config::get(value, target, 1);
-    set(link, value);
+    if (target.size() == 1) set(link, it->second);
+    else set(link, config::get(it->second, target, 1));
 }
 
 
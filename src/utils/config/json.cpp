@@ -6,7 +6,7 @@
 */
 
 #include "includes.h"
-#include "utils/json/token.h"
+#include "utils/json/json.h"
 
 #include <sstream>
 
@@ -40,33 +40,47 @@ parseKey(const std::string& str)
     return std::make_tuple(isLink, key, str.substr(next));
 }
 
+// The reader records its errors while the config reports them right away.
+Token nextToken(Reader& reader)
+{
+    Token token = reader.nextToken();
+    if (!reader) reflectError("%s", reader.error().what());
+    return token;
+}
+
+void expectToken(Reader& reader, const Token& token, Token::Type type)
+{
+    if (!reader.assertToken(token, type))
+        reflectError("%s", reader.error().what());
+}
+
 
 /******************************************************************************/
 /* LOAD                                                                       */
 /******************************************************************************/
 
-void load(Config& cfg, const Path& path, std::istream& json);
-void load(Config& cfg, const Path& path, const Token& token, std::istream& json);
+void load(Config& cfg, const Path& path, Reader& reader);
+void load(Config& cfg, const Path& path, const Token& token, Reader& reader);
 
-void loadLink(Config& cfg, const Path& path, std::istream& json);
-void loadLink(Config& cfg, const Path& path, const Token& token, std::istream& json);
+void loadLink(Config& cfg, const Path& path, Reader& reader);
+void loadLink(Config& cfg, const Path& path, const Token& token, Reader& reader);
 
 
 void loadNull(Config&, const Path&) {}
 
 void loadBool(Config& cfg, const Path& path, Token token)
 {
-    cfg.set(path, Value(token.boolValue()));
+    cfg.set(path, Value(token.asBool()));
 }
 
 void loadNumber(Config& cfg, const Path& path, Token token)
 {
-    cfg.set(path, Value(token.floatValue()));
+    cfg.set(path, Value(token.asFloat()));
 }
 
 void loadString(Config& cfg, const Path& path, Token token)
 {
-    cfg.set(path, Value(token.stringValue()));
+    cfg.set(path, Value(token.asString()));
 }
 
 
@@ -76,7 +90,8 @@ void initArray(Config& cfg, const Path& path, const Token& token)
 
     switch(token.type())
     {
-    case Token::Number: tVector = type< std::vector<double> >(); break;
+    case Token::Int:
+    case Token::Float: tVector = type< std::vector<double> >(); break;
     case Token::String: tVector = type< std::vector<std::string> >(); break;
     default:
         reflectError("unexpected token <%s> for untyped array <%s>",
@@ -86,24 +101,24 @@ void initArray(Config& cfg, const Path& path, const Token& token)
     cfg.set(path, tVector->construct());
 }
 
-void loadArray(Config& cfg, const Path& path, std::istream& json)
+void loadArray(Config& cfg, const Path& path, Reader& reader)
 {
-    Token token = nextToken(json);
+    Token token = nextToken(reader);
     if (token.type() == Token::ArrayEnd) return;
 
     if (path.size() == 1) initArray(cfg, path, token);
 
-    for (size_t i = 0; json; ++i) {
+    for (size_t i = 0; reader; ++i) {
 
-        load(cfg, Path(path, i), token, json);
+        load(cfg, Path(path, i), token, reader);
 
-        token = nextToken(json);
+        token = nextToken(reader);
         if (token.type() == Token::Separator) {
-            token = nextToken(json);
+            token = nextToken(reader);
             continue;
         }
 
-        expectToken(token, Token::ArrayEnd);
+        expectToken(reader, token, Token::ArrayEnd);
         return;
     }
 
@@ -113,62 +128,62 @@ void loadArray(Config& cfg, const Path& path, std::istream& json)
 
 void loadLinkString(Config& cfg, const Path& path, Token token)
 {
-    cfg.link(path, token.stringValue());
+    cfg.link(path, token.asString());
 }
 
-void loadLinkArray(Config& cfg, const Path& path, std::istream& json)
+void loadLinkArray(Config& cfg, const Path& path, Reader& reader)
 {
-    Token token = nextToken(json);
+    Token token = nextToken(reader);
     if (token.type() == Token::ArrayEnd) return;
 
-    for (size_t i = 0; json; ++i) {
+    for (size_t i = 0; reader; ++i) {
 
-        loadLink(cfg, Path(path, i), token, json);
+        loadLink(cfg, Path(path, i), token, reader);
 
-        token = nextToken(json);
+        token = nextToken(reader);
 
         if (token.type() == Token::Separator) {
-            token = nextToken(json);
+            token = nextToken(reader);
             continue;
         }
 
-        expectToken(token, Token::ArrayEnd);
+        expectToken(reader, token, Token::ArrayEnd);
         return;
     }
 
     reflectError("unexpected end of array");
 }
 
-void loadLink(Config& cfg, const Path& path, const Token& token, std::istream& json)
+void loadLink(Config& cfg, const Path& path, const Token& token, Reader& reader)
 {
     switch (token.type())
     {
     case Token::String: loadLinkString(cfg, path, token); break;
-    case Token::ArrayStart: loadLinkArray(cfg, path, json); break;
+    case Token::ArrayStart: loadLinkArray(cfg, path, reader); break;
     default:
         reflectError("unexpected link token <%s> in <%s>",
                 token.print(), path.toString());
     }
 }
 
-void loadLink(Config& cfg, const Path& path, std::istream& json)
+void loadLink(Config& cfg, const Path& path, Reader& reader)
 {
-    loadLink(cfg, path, nextToken(json), json);
+    loadLink(cfg, path, nextToken(reader), reader);
 }
 
-void loadObject(Config& cfg, const Path& path, std::istream& json)
+void loadObject(Config& cfg, const Path& path, Reader& reader)
 {
-    Token token = nextToken(json);
+    Token token = nextToken(reader);
     if (token.type() == Token::ObjectEnd) return;
 
-    while (json) {
+    while (reader) {
 
-        expectToken(token, Token::String);
-        expectToken(nextToken(json), Token::KeySeparator);
+        expectToken(reader, token, Token::String);
+        expectToken(reader, nextToken(reader), Token::KeySeparator);
 
         bool isLink;
         std::string key, type;
-        std::tie(isLink, key, type) = parseKey(token.stringValue());
+        std::tie(isLink, key, type) = parseKey(token.asString());
 
         Path sub(path, key);
 
@@ -179,17 +194,17 @@ void loadObject(Config& cfg, const Path& path, std::istream& json)
             cfg.set(sub, reflect::type(type)->alloc());
         }
 
-        if (isLink) loadLink(cfg, sub, json);
-        else load(cfg, sub, json);
+        if (isLink) loadLink(cfg, sub, reader);
+        else load(cfg, sub, reader);
 
 
-        token = nextToken(json);
+        token = nextToken(reader);
         if (token.type() == Token::Separator) {
-            token = nextToken(json);
+            token = nextToken(reader);
             continue;
         }
 
-        expectToken(token, Token::ObjectEnd);
+        expectToken(reader, token, Token::ObjectEnd);
         return;
     }
 
@@ -197,25 +212,25 @@ void loadObject(Config& cfg, const Path& path, std::istream& json)
 }
 
 
-void load(Config& cfg, const Path& path, const Token& token, std::istream& json)
+void load(Config& cfg, const Path& path, const Token& token, Reader& reader)
 {
     switch(token.type())
     {
     case Token::Null: loadNull(cfg, path); break;
     case Token::Bool: loadBool(cfg, path, token); break;
-    case Token::Number: loadNumber(cfg, path, token); break;
+    case Token::Int:
+    case Token::Float: loadNumber(cfg, path, token); break;
     case Token::String: loadString(cfg, path, token); break;
-    case Token::ArrayStart: loadArray(cfg, path, json); break;
-    case Token::ObjectStart: loadObject(cfg, path, json); break;
+    case Token::ArrayStart: loadArray(cfg, path, reader); break;
+    case Token::ObjectStart: loadObject(cfg, path, reader); break;
 
     default: reflectError("unexpected token <%s>", token.print());
     }
 }
 
-void load(Config& cfg, const Path& path, std::istream& json)
+void load(Config& cfg, const Path& path, Reader& reader)
 {
-    load(cfg, path, nextToken(json), json);
-
+    load(cfg, path, nextToken(reader), reader);
 }
 
 } // namespace anonymous
@@ -223,7 +238,8 @@ void load(Config& cfg, const Path& path, std::istream& json)
 
 void loadJson(Config& cfg, std::istream& json)
 {
-    load(cfg, Path(), json);
+    Reader reader(json);
+    load(cfg, Path(), reader);
 }
 
 void loadJson(Config& cfg, const std::string& json)
@@ -95,8 +95,8 @@ index(size_t index) const
     const auto& item = items[index];
 
     for (char c : item) {
-        if (!std::isdigit(c))
-            reflectError("component at <%s> is not an index <%s>", index, item);
+        if (std::isdigit(c)) continue;
+        reflectError("component at <%lu> is not an index <%s>", index, item);
     }
 
     return std::stoull(item);
@@ -110,7 +110,7 @@ popFront() const
 
     Path result;
     result.items.insert(result.items.begin(), items.begin() + 1, items.end());
-    return std::move(result);
+    return result;
 }
 
 Path
@@ -121,7 +121,7 @@ popBack() const
 
     Path result;
     result.items.insert(result.items.begin(), items.begin(), items.end() - 1);
-    return std::move(result);
+    return result;
 }
 
 bool
@@ -139,13 +139,186 @@ operator<(const Path& other) const
 }
 
 
+/******************************************************************************/
+/* COMPILE                                                                    */
+/******************************************************************************/
+
+namespace {
+
+const Function& resolve(
+        const Type* type, const std::string& name, bool isConst,
+        const Value* arg = nullptr)
+{
+    Argument args[] = {
+        Argument(type, RefType::LValue, isConst),
+        arg ? arg->argument() : Argument()
+    };
+
+    return type->function(name).resolve(
+            Argument::make<Value>(), args, arg ? 2 : 1);
+}
+
+} // namespace anonymous
+
+CompiledPath
+Path::
+compile(const Type* root) const
+{
+    CompiledPath result;
+    result.root_ = root;
+    result.target_ = Argument(root, RefType::LValue, false);
+
+    size_t i = 0;
+    while (i < items.size()) {
+        const Type* type = result.target_.type();
+        bool isConst = result.target_.isConst();
+
+        // Pointers don't consume a component of the path.
+        if (type->isPointer()) {
+            const Function& fn = resolve(type, "operator*", isConst);
+
+            if (type->pointer() == "*") result.load(fn.returnType());
+            else result.call(fn, nullptr, Value());
+            continue;
+        }
+
+        if (type->is("list")) {
+            Value pos(index(i));
+            const Function& fn = resolve(type, "operator[]", isConst, &pos);
+            const Function& size = resolve(type, "size", true);
+            result.call(fn, &size, std::move(pos));
+        }
+
+        else if (type->is("map")) {
+            Value key(std::string(items[i]));
+            const Function& fn = resolve(type, "operator[]", isConst, &key);
+            result.call(fn, nullptr, std::move(key));
+        }
+
+        else {
+            const Field& field = type->field(items[i]);
+            isConst = isConst || field.argument().isConst();
+            result.offset(field.offset(),
+                    Argument(field.type(), RefType::LValue, isConst));
+        }
+
+        ++i;
+    }
+
+    return result;
+}
+
+
+/******************************************************************************/
+/* COMPILED PATH                                                              */
+/******************************************************************************/
+
+void
+CompiledPath::
+offset(size_t offset, const Argument& target)
+{
+    target_ = target;
+
+    // Statically known offsets are folded into a single pointer add.
+    if (!steps_.empty() && steps_.back().op == Op::Offset) {
+        steps_.back().offset += offset;
+        steps_.back().target = target;
+        return;
+    }
+
+    steps_.push_back(
+            Step{ Op::Offset, target, offset, nullptr, nullptr, Value() });
+}
+
+void
+CompiledPath::
+load(const Argument& target)
+{
+    target_ = Argument(target.type(), RefType::LValue, target.isConst());
+    steps_.push_back(Step{ Op::Load, target_, 0, nullptr, nullptr, Value() });
+}
+
+void
+CompiledPath::
+call(const Function& fn, const Function* size, Value arg)
+{
+    hasCalls = true;
+
+    const Argument& ret = fn.returnType();
+    target_ = Argument(ret.type(), RefType::LValue, ret.isConst());
+    steps_.push_back(Step{ Op::Call, target_, 0, &fn, size, std::move(arg) });
+}
+
+Value
+CompiledPath::
+get(const Value& value) const
+{
+    if (value.type() != root_ && !value.type()->isChildOf(root_)) {
+        reflectError("<%s> is not a child of <%s>",
+                value.type()->id(), root_->id());
+    }
+
+    if (hasCalls && value.isConst()) {
+        reflectError("compiled path on <%s> requires a mutable value",
+                root_->id());
+    }
+
+    return get(value, 0);
+}
+
+// Recursive like get() to ensure that rvalue returns remain valid during the
+// duration of the access.
+Value
+CompiledPath::
+get(const Value& value, size_t index) const
+{
+    if (index == steps_.size()) return value;
+
+    const Step& step = steps_[index];
+
+    switch (step.op) {
+
+    case Op::Offset: {
+        bool isConst = value.isConst() || step.target.isConst();
+        void* field = static_cast<uint8_t*>(value.value()) + step.offset;
+
+        Argument arg(step.target.type(), RefType::LValue, isConst);
+        return get(ValueRef(arg, field).toValue(), index + 1);
+    }
+
+    case Op::Load: {
+        void* pointee = *static_cast<void**>(value.value());
+        if (!pointee) reflectError("null <%s> in path", value.type()->id());
+
+        return get(ValueRef(step.target, pointee).toValue(), index + 1);
+    }
+
+    case Op::Call: {
+        if (step.size) {
+            size_t size = step.size->callUnchecked<size_t>(value);
+            size_t i = step.arg.get<size_t>();
+            if (i >= size)
+                reflectError("index <%lu> out-of-bound <%lu>", i, size);
+        }
+
+        if (step.arg.isVoid())
+            return get(step.fn->callUnchecked<Value>(value), index + 1);
+        return get(step.fn->callUnchecked<Value>(value, step.arg), index + 1);
+    }
+
+    }
+
+    reflectError("unknown compiled path step");
+}
+
+
 /******************************************************************************/
 /* UTILS                                                                      */
 /******************************************************************************/
 // We use recursive pathing to ensure that rvalue returns remain valid during
 // the duration of the access.
 
-bool has(Value value, const Path& path, size_t index)
+bool has(const Value& value, const Path& path, size_t index)
 {
     if (index == path.size()) return true;
 
@@ -160,8 +333,8 @@ bool has(Value value, const Path& path, size_t index)
     }
 
     if (value.is("map")) {
-        if (value.type()->call<const Type*>("keyType") != type<std::string>())
-            return false;
+        const Type* keyType = value.type()->getValue<const Type*>("keyType");
+        if (keyType != type<std::string>()) return false;
 
         if (!value.call<size_t>("count", path[index]))
             return false;
@@ -171,11 +344,11 @@ bool has(Value value, const Path& path, size_t index)
 
     if (!value.type()->hasField(path[index])) return false;
 
-    return has(value.get<Value>(path[index]), path, index + 1);
+    return has(value.field<Value>(path[index]), path, index + 1);
 }
 
 
-Value get(Value value, const Path& path, size_t index)
+Value get(const Value& value, const Path& path, size_t index)
 {
     if (index == path.size()) return value;
 
@@ -191,7 +364,7 @@ Value get(Value value, const Path& path, size_t index)
     if (value.is("map"))
         return get(value[path[index]], path, index + 1);
 
-    return get(value.get<Value>(path[index]), path, index + 1);
+    return get(value.field<Value>(path[index]), path, index + 1);
 }
 
 
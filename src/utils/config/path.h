@@ -11,6 +11,8 @@
 namespace reflect {
 namespace config {
 
+struct CompiledPath;
+
 /******************************************************************************/
 /* PATH                                                                       */
 /******************************************************************************/
@@ -42,6 +44,9 @@ struct Path
 
     std::string toString(char sep = '.') const;
 
+    // Resolves the path against objects of type root.
+    CompiledPath compile(const Type* root) const;
+
 private:
     void parse(const std::string& path, char sep);
 
@@ -49,15 +54,69 @@ private:
 };
 
 
+/******************************************************************************/
+/* COMPILED PATH                                                              */
+/******************************************************************************/
+/** Path that was resolved ahead of time against a root type so that it can be
+    evaluated without doing any string work. Runs of fields are folded into a
+    single offset, raw pointers are dereferenced with a load and list indexes
+    or map keys become calls to a resolved operator[] overload.
+
+    Unlike get(), lists are not resized when an index is out of bounds and
+    values with a const root can only go through paths made of fields.
+ */
+
+struct CompiledPath
+{
+    CompiledPath() : root_(nullptr), hasCalls(false) {}
+
+    const Type* root() const { return root_; }
+    const Argument& target() const { return target_; }
+    size_t steps() const { return steps_.size(); }
+
+    Value get(const Value& value) const;
+
+    template<typename Ret>
+    Ret get(const Value& value) const { return retCast<Ret>(get(value)); }
+
+private:
+    friend struct Path;
+
+    enum struct Op { Offset, Load, Call };
+
+    struct Step
+    {
+        Op op;
+        Argument target;
+
+        size_t offset;
+        const Function* fn;
+        const Function* size;
+        Value arg;
+    };
+
+    void offset(size_t offset, const Argument& target);
+    void load(const Argument& target);
+    void call(const Function& fn, const Function* size, Value arg);
+
+    Value get(const Value& value, size_t index) const;
+
+    const Type* root_;
+    Argument target_;
+    bool hasCalls;
+    std::vector<Step> steps_;
+};
+
+
 /******************************************************************************/
 /* UTILS                                                                      */
 /******************************************************************************/
 
-bool has(Value value, const Path& path, size_t index = 0);
-Value get(Value value, const Path& path, size_t index = 0);
+bool has(const Value& value, const Path& path, size_t index = 0);
+Value get(const Value& value, const Path& path, size_t index = 0);
 
 template<typename Ret>
-Ret get(Value value, const Path& path)
+Ret get(const Value& value, const Path& path)
 {
     Value v = get(value, path.popBack());
     return v.get<Ret>(path.back());
@@ -66,26 +125,37 @@ Ret get(Value value, const Path& path)
 namespace details{
 
 template<typename Arg>
-void set(Value value, const Path& path, size_t index, Arg&& arg);
+void set(const Value& value, const Path& path, size_t index, Arg&& arg);
 
 } // namespace details
 
+// Paths of a single component are applied to value itself as get() would
+// return a copy of the objects stored inline in value.
 template<typename Arg>
-void set(Value value, const Path& path, size_t index, Arg&& arg)
+void set(const Value& value, const Path& path, size_t index, Arg&& arg)
 {
+    size_t last = path.size() - 1;
+    if (index == last) {
+        details::set(value, path, last, std::forward<Arg>(arg));
+        return;
+    }
+
     Value v = get(value, path.popBack(), index);
-    details::set(v, path, path.size() - 1, std::forward<Arg>(arg));
+    details::set(v, path, last, std::forward<Arg>(arg));
 }
 
 template<typename Arg>
-void set(Value value, const Path& path, Arg&& arg)
+void set(const Value& value, const Path& path, Arg&& arg)
 {
     set(value, path, 0, std::forward<Arg>(arg));
 }
 
 template<typename Ret, typename... Args>
-Ret call(Value value, const Path& path, Args&&... args)
+Ret call(const Value& value, const Path& path, Args&&... args)
 {
+    if (path.size() == 1)
+        return value.call<Ret>(path.back(), std::forward<Args>(args)...);
+
     Value v = get(value, path.popBack());
     return v.call<Ret>(path.back(), std::forward<Args>(args)...);
 }
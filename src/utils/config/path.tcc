@@ -13,7 +13,7 @@ namespace config {
 namespace details {
 
 template<typename Arg>
-void set(Value value, const Path& path, size_t index, Arg&& arg)
+void set(const Value& value, const Path& path, size_t index, Arg&& arg)
 {
     if (value.type()->isPointer())
         details::set(*value, path, index, std::forward<Arg>(arg));
@@ -26,7 +26,7 @@ void set(Value value, const Path& path, size_t index, Arg&& arg)
     else if (value.is("map"))
         value[path[index]].assign(std::forward<Arg>(arg));
 
-    else value.set(path[index], std::forward<Arg>(arg));
+    else value.field<Value>(path[index]).assign(std::forward<Arg>(arg));
 }
 
 } // namespace details
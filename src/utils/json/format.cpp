@@ -45,12 +45,14 @@ void format(Writer& writer, const char* format, T value)
 
 void formatInt(Writer& writer, int64_t value)
 {
-    format(writer, "%ld", value);
+    char buffer[32];
+    writer.push(buffer, intToChars(value, buffer));
 }
 
 void formatFloat(Writer& writer, double value)
 {
-    format(writer, "%1.12g", value);
+    char buffer[32];
+    writer.push(buffer, floatToChars(value, buffer));
 }
 
 size_t escapeUnicode(Writer& writer, const std::string& value, size_t i)
@@ -10,15 +10,34 @@
 #include "types/std/map.h"
 #include "types/reflect/type.h"
 #include "types/reflect/value.h"
+#include "types/reflect/value_ref.h"
 #include "types/primitives.h"
 #include "dsl/all.h"
 #include "utils.h"
 
 #include <mutex>
+#include <atomic>
 #include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+#include <cmath>
 
+#include <fcntl.h>
+#include <locale.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
+#include "scan.cpp"
 #include "reader.cpp"
 #include "writer.cpp"
+#include "number.cpp"
 #include "token.cpp"
 #include "traits.cpp"
 #include "parser.cpp"
@@ -21,6 +21,7 @@ struct Reader;
 
 #include "error.h"
 #include "token.h"
+#include "scan.h"
 #include "reader.h"
 #include "writer.h"
 #include "traits.h"
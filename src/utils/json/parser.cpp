@@ -25,7 +25,7 @@ struct Parser
 {
     virtual ~Parser() {};
     virtual void init(const Type*) {}
-    virtual void parse(Reader& reader, Value& value) const = 0;
+    virtual void parse(Reader& reader, ValueRef value) const = 0;
 };
 
 const Parser* getParser(const Type* type);
@@ -55,7 +55,7 @@ struct TypeParser
 
 struct BoolParser : public Parser
 {
-    void parse(Reader& reader, Value& value) const
+    void parse(Reader& reader, ValueRef value) const
     {
         value.assign(parseBool(reader));
     }
@@ -63,7 +63,7 @@ struct BoolParser : public Parser
 
 struct IntParser : public Parser
 {
-    void parse(Reader& reader, Value& value) const
+    void parse(Reader& reader, ValueRef value) const
     {
         value.assign(parseInt(reader));
     }
@@ -71,7 +71,7 @@ struct IntParser : public Parser
 
 struct FloatParser : public Parser
 {
-    void parse(Reader& reader, Value& value) const
+    void parse(Reader& reader, ValueRef value) const
     {
         value.assign(parseFloat(reader));
     }
@@ -79,10 +79,22 @@ struct FloatParser : public Parser
 
 struct StringParser : public Parser
 {
-    void parse(Reader& reader, Value& value) const
+    void init(const Type* type)
     {
-        value.assign(parseString(reader));
+        isStdString = type == reflect::type<std::string>();
     }
+
+    // std::string is assigned straight from the token to reuse its storage
+    // while other string types go through their reflected operator=.
+    void parse(Reader& reader, ValueRef value) const
+    {
+        if (isStdString && !value.isConst())
+            parseString(reader, value.as<std::string>());
+        else value.assign(parseString(reader));
+    }
+
+private:
+    bool isStdString;
 };
 
 
@@ -98,19 +110,16 @@ struct PointerParser : public Parser
         isSmartPtr = type->is("smartPtr");
     }
 
-    void parse(Reader& reader, Value& ptr) const
+    void parse(Reader& reader, ValueRef ptr) const
     {
         if (reader.peekToken().type() == Token::Null) {
             reader.nextToken();
-
             if (isSmartPtr) ptr.call<void>("reset");
-            else ptr = inner.type->construct();
-
             return;
         }
 
         if (cast<bool>(ptr)) {
-            Value pointee = *ptr;
+            Value pointee = ptr.call<Value>("operator*");
             inner.parser->parse(reader, pointee);
         }
 
@@ -141,7 +150,7 @@ struct ArrayParser : public Parser
         inner.init(type->getValue<const Type*>("valueType"));
     }
 
-    void parse(Reader& reader, Value& array) const
+    void parse(Reader& reader, ValueRef array) const
     {
         auto onItem = [&] (size_t) {
             Value item = inner.type->construct();
@@ -171,7 +180,7 @@ struct MapParser : public Parser
         inner.init(type->getValue<const Type*>("valueType"));
     }
 
-    void parse(Reader& reader, Value& map) const
+    void parse(Reader& reader, ValueRef map) const
     {
         // need to copy the key because we use the key only after we've parsed
         // the value.
@@ -182,7 +191,7 @@ struct MapParser : public Parser
             if (!reader) return;
 
             if (inner.movable) value = value.rvalue();
-            map[key].assign(value);
+            map.call<Value>("operator[]", key).assign(value);
         };
         parseObject(reader, onField);
     }
@@ -221,7 +230,7 @@ struct ObjectParser : public Parser
         }
     }
 
-    void parse(Reader& reader, Value& obj) const
+    void parse(Reader& reader, ValueRef obj) const
     {
         auto onField = [&] (const std::string& alias) {
             auto keyIt = keys.find(alias);
@@ -236,7 +245,7 @@ struct ObjectParser : public Parser
             if (fieldIt == fields.end())
                 reflectError("missing field <%s> for alias <%s>", key, alias);
 
-            Value field = obj.field(key);
+            ValueRef field = obj.field(key);
             fieldIt->second.parser->parse(reader, field);
         };
         parseObject(reader, onField);
@@ -263,7 +272,7 @@ struct CustomParser : public Parser
         parser = &type->function(name).get<void(Value, Reader&)>();
     }
 
-    void parse(Reader& reader, Value& value) const
+    void parse(Reader& reader, ValueRef value) const
     {
         parser->call<void>(value, reader);
     }
@@ -276,8 +285,10 @@ private:
 /******************************************************************************/
 /* VALUE PARSER                                                               */
 /******************************************************************************/
+// Parses into a void Value which requires the Value itself to be replaced and
+// can therefore not go through a ValueRef like the other parsers.
 
-struct ValueParser : public Parser
+struct ValueParser
 {
     typedef std::vector<Value> ArrayT;
     typedef std::unordered_map<std::string, Value> ObjectT;
@@ -350,7 +361,8 @@ const Parser* getParser(const Type* type)
     else if (type->is("list")) parser = new ArrayParser;
 
     else if (!customParser(type).empty()) parser = new CustomParser;
-    else if (type == reflect::type<void>()) parser = new ValueParser;
+    else if (type == reflect::type<void>())
+        reflectError("unable to parse void value by reference");
 
     else parser = new ObjectParser;
 
@@ -375,11 +387,17 @@ const Parser* getParserLocked(const Type* type)
 /* PARSE                                                                      */
 /******************************************************************************/
 
-void parse(Reader& reader, Value& value)
+void parse(Reader& reader, ValueRef value)
 {
     getParserLocked(value.type())->parse(reader, value);
 }
 
+void parse(Reader& reader, Value& value)
+{
+    if (value.isVoid()) ValueParser().parse(reader, value);
+    else parse(reader, ValueRef(value));
+}
+
 } // namespace json
 } // namespace reflect
 
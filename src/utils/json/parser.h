@@ -20,6 +20,7 @@ inline bool parseBool(Reader& reader);
 inline int64_t parseInt(Reader& reader);
 inline double parseFloat(Reader& reader);
 inline std::string parseString(Reader& reader);
+inline void parseString(Reader& reader, std::string& value);
 template<typename Fn> void parseObject(Reader& reader, const Fn& fn);
 template<typename Fn> void parseArray(Reader& reader, const Fn& fn);
 
@@ -28,10 +29,13 @@ template<typename Fn> void parseArray(Reader& reader, const Fn& fn);
 /* VALUE PARSER                                                               */
 /******************************************************************************/
 
+void parse(Reader& reader, ValueRef value);
 void parse(Reader& reader, Value& value);
 template<typename T> void parse(Reader& reader, T& value);
 template<typename T> Error parse(std::istream& stream, T& value);
+template<typename T> Error parse(const char* data, size_t size, T& value);
 template<typename T> Error parse(const std::string& str, T& value);
+template<typename T> Error parseFile(const std::string& path, T& value);
 
 } // namespace json
 } // namespace reflect
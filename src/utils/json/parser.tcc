@@ -44,6 +44,11 @@ std::string parseString(Reader& reader)
     return reader.expectToken(Token::String).asString();
 }
 
+void parseString(Reader& reader, std::string& value)
+{
+    reader.expectToken(Token::String).assignString(value);
+}
+
 template<typename Fn>
 void parseObject(Reader& reader, const Fn& fn)
 {
@@ -57,9 +62,12 @@ void parseObject(Reader& reader, const Fn& fn)
         return;
     }
 
+    // Reused across keys to avoid reallocating it for every field.
+    std::string key;
+
     while (reader) {
         token = reader.expectToken(Token::String);
-        const std::string& key = token.asString();
+        token.assignString(key);
         token = reader.expectToken(Token::KeySeparator);
 
         fn(key);
@@ -131,8 +139,7 @@ void skip(Reader& reader)
 template<typename T>
 void parse(Reader& reader, T& value)
 {
-    Value v = cast<Value>(value);
-    parse(reader, v);
+    parse(reader, ValueRef(value));
 }
 
 template<typename T>
@@ -143,11 +150,27 @@ Error parse(std::istream& stream, T& value)
     return reader.error();
 }
 
+template<typename T>
+Error parse(const char* data, size_t size, T& value)
+{
+    Reader reader(data, size);
+    parse(reader, value);
+    return reader.error();
+}
+
 template<typename T>
 Error parse(const std::string& str, T& value)
 {
-    std::istringstream stream(str);
-    return parse(stream, value);
+    return parse(str.data(), str.size(), value);
+}
+
+template<typename T>
+Error parseFile(const std::string& path, T& value)
+{
+    MappedFile file(path);
+    if (file.error()) return file.error();
+
+    return parse(file.data(), file.size(), value);
 }
 
 } // namespace json
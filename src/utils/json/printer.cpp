@@ -19,22 +19,22 @@ void printString(Writer& writer, const std::string& value)
     formatString(writer, value);
 }
 
-void printBool(Writer& writer, const Value& value)
+void printBool(Writer& writer, ValueRef value)
 {
     formatBool(writer, cast<bool>(value));
 }
 
-void printInt(Writer& writer, const Value& value)
+void printInt(Writer& writer, ValueRef value)
 {
     formatInt(writer, cast<int64_t>(value));
 }
 
-void printFloat(Writer& writer, const Value& value)
+void printFloat(Writer& writer, ValueRef value)
 {
     formatFloat(writer, cast<double>(value));
 }
 
-void printString(Writer& writer, const Value& value)
+void printString(Writer& writer, ValueRef value)
 {
     formatString(writer, cast<std::string>(value));
 }
@@ -63,8 +63,8 @@ struct Printer
     virtual ~Printer() {}
 
     virtual void init(const Type*) {}
-    virtual bool isEmpty(const Value&) const { return false; }
-    virtual void print(Writer& writer, const Value& value) const = 0;
+    virtual bool isEmpty(ValueRef) const { return false; }
+    virtual void print(Writer& writer, ValueRef value) const = 0;
 };
 
 const Printer* getPrinter(const Type* type);
@@ -92,7 +92,7 @@ struct TypePrinter
 
 struct BoolPrinter : public Printer
 {
-    void print(Writer& writer, const Value& value) const
+    void print(Writer& writer, ValueRef value) const
     {
         printBool(writer, value);
     }
@@ -100,12 +100,12 @@ struct BoolPrinter : public Printer
 
 struct IntPrinter : public Printer
 {
-    bool isEmpty(const Value& value) const
+    bool isEmpty(ValueRef value) const
     {
         return cast<const int64_t&>(value) == 0;
     }
 
-    void print(Writer& writer, const Value& value) const
+    void print(Writer& writer, ValueRef value) const
     {
         printInt(writer, value);
     }
@@ -113,12 +113,12 @@ struct IntPrinter : public Printer
 
 struct FloatPrinter : public Printer
 {
-    bool isEmpty(const Value& value) const
+    bool isEmpty(ValueRef value) const
     {
         return cast<const double&>(value) == 0;
     }
 
-    void print(Writer& writer, const Value& value) const
+    void print(Writer& writer, ValueRef value) const
     {
         printFloat(writer, value);
     }
@@ -126,12 +126,12 @@ struct FloatPrinter : public Printer
 
 struct StringPrinter : public Printer
 {
-    bool isEmpty(const Value& value) const
+    bool isEmpty(ValueRef value) const
     {
         return value.call<size_t>("size") == 0;
     }
 
-    void print(Writer& writer, const Value& value) const
+    void print(Writer& writer, ValueRef value) const
     {
         printString(writer, value);
     }
@@ -146,19 +146,20 @@ struct PointerPrinter : public Printer
 {
     void init(const Type* type) { inner.init(type->pointee()); }
 
-    bool isEmpty(const Value& ptr) const
+    bool isEmpty(ValueRef ptr) const
     {
-        return !cast<bool>(ptr) || inner.printer->isEmpty(*ptr);
+        if (!cast<bool>(ptr)) return true;
+        return inner.printer->isEmpty(ptr.call<Value>("operator*"));
     }
 
-    void print(Writer& writer, const Value& ptr) const
+    void print(Writer& writer, ValueRef ptr) const
     {
         if (!cast<bool>(ptr)) {
             printNull(writer);
             return;
         }
 
-        Value pointee = *ptr;
+        Value pointee = ptr.call<Value>("operator*");
         inner.printer->print(writer, pointee);
     }
 
@@ -178,12 +179,12 @@ struct ArrayPrinter : public Printer
         inner.init(type->getValue<const Type*>("valueType"));
     }
 
-    bool isEmpty(const Value& array) const
+    bool isEmpty(ValueRef array) const
     {
         return array.call<size_t>("size") == 0;
     }
 
-    void print(Writer& writer, const Value& array) const
+    void print(Writer& writer, ValueRef array) const
     {
         auto printFn = [&] (size_t i) {
             Value item = array.call<Value>("at", i);
@@ -208,12 +209,12 @@ struct MapPrinter : public Printer
         inner.init(type->getValue<const Type*>("valueType"));
     }
 
-    bool isEmpty(const Value& map) const
+    bool isEmpty(ValueRef map) const
     {
         return map.call<size_t>("size") == 0;
     }
 
-    void print(Writer& writer, const Value& map) const
+    void print(Writer& writer, ValueRef map) const
     {
         auto keys = map.call< std::vector<std::string> >("keys");
 
@@ -265,7 +266,7 @@ struct ObjectPrinter : public Printer
         std::sort(sortedKeys.begin(), sortedKeys.end());
     }
 
-    void print(Writer& writer, const Value& obj) const
+    void print(Writer& writer, ValueRef obj) const
     {
         auto getField = [&] (const std::string& alias) {
             auto keyIt = keys.find(alias);
@@ -287,14 +288,14 @@ struct ObjectPrinter : public Printer
 
             auto it = getField(alias);
 
-            Value field = obj.field(it->first);
+            ValueRef field = obj.field(it->first);
             return it->second.printer->isEmpty(field);
         };
 
         auto printFn = [&] (const std::string& alias) {
             auto it = getField(alias);
 
-            Value field = obj.field(it->first);
+            ValueRef field = obj.field(it->first);
             it->second.printer->print(writer, field);
         };
 
@@ -324,7 +325,7 @@ struct CustomPrinter : public Printer
         printer = &type->function(name).get<void(Value, Writer&)>();
     }
 
-    void print(Writer& writer, const Value& value) const
+    void print(Writer& writer, ValueRef value) const
     {
         printer->call<void>(value, writer);
     }
@@ -383,10 +384,15 @@ const Printer* getPrinterLocked(const Type* type)
 /* PRINT                                                                      */
 /******************************************************************************/
 
-void print(Writer& writer, const Value& value)
+void print(Writer& writer, ValueRef value)
 {
     getPrinterLocked(value.type())->print(writer, value);
 }
 
+void print(Writer& writer, const Value& value)
+{
+    print(writer, ValueRef(value));
+}
+
 } // namespace json
 } // namespace reflect
@@ -18,10 +18,10 @@ void printInt(Writer& writer, int64_t value);
 void printFloat(Writer& writer, double value);
 void printString(Writer& writer, const std::string& value);
 
-void printBool(Writer& writer, const Value& value);
-void printInt(Writer& writer, const Value& value);
-void printFloat(Writer& writer, const Value& value);
-void printString(Writer& writer, const Value& value);
+void printBool(Writer& writer, ValueRef value);
+void printInt(Writer& writer, ValueRef value);
+void printFloat(Writer& writer, ValueRef value);
+void printString(Writer& writer, ValueRef value);
 
 template<typename Keys, typename Fn>
 void printObject(Writer& writer, const Keys& keys, const Fn& printFn);
@@ -40,6 +40,7 @@ void printArray(Writer& writer, size_t n, const PrintFn& printFn, const SkipFn&
 /* VALUE PRINTER                                                              */
 /******************************************************************************/
 
+void print(Writer& writer, ValueRef value);
 void print(Writer& writer, const Value& value);
 template<typename T> Error print(Writer& writer, const T& value);
 template<typename T> Error print(std::ostream& stream, const T& value);
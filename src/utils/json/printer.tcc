@@ -105,8 +105,7 @@ void printArray(Writer& writer, size_t n, const PrintFn& printFn, const SkipFn&
 template<typename T>
 Error print(Writer& writer, const T& value)
 {
-    Value v = cast<Value>(value);
-    print(writer, v);
+    print(writer, ValueRef(value));
     return writer.error();
 }
 
@@ -8,10 +8,148 @@
 namespace reflect {
 namespace json {
 
+/******************************************************************************/
+/* MAPPED FILE                                                                */
+/******************************************************************************/
+
+MappedFile::
+MappedFile(const std::string& path) :
+    data_(nullptr), size_(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_ = Error(errorFormat("unable to open <%s>: %s",
+                        path, std::strerror(errno)));
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        error_ = Error(errorFormat("unable to stat <%s>: %s",
+                        path, std::strerror(errno)));
+        close(fd);
+        return;
+    }
+
+    // mmap doesn't support empty mappings.
+    if (st.st_size) {
+        void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            error_ = Error(errorFormat("unable to map <%s>: %s",
+                            path, std::strerror(errno)));
+        }
+        else {
+            madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(ptr);
+            size_ = st.st_size;
+        }
+    }
+
+    close(fd);
+}
+
+MappedFile::
+~MappedFile()
+{
+    if (data_) munmap(const_cast<char*>(data_), size_);
+}
+
+
 /******************************************************************************/
 /* READER                                                                     */
 /******************************************************************************/
 
+Reader::
+Reader(std::istream& stream, Options options) :
+    stream(stream.rdbuf()), failed(!stream),
+    begin_(nullptr), cur_(nullptr), end_(nullptr),
+    scanner_(&json::scanner()),
+    pos_(1), line_(1),
+    options(options)
+{
+    buffer_.reserve(128);
+}
+
+Reader::
+Reader(const char* data, size_t size, Options options) :
+    stream(nullptr), failed(false),
+    begin_(data), cur_(data), end_(data + size),
+    scanner_(&json::scanner()),
+    pos_(1), line_(1),
+    options(options)
+{
+    buffer_.reserve(128);
+}
+
+Reader::
+Reader(const std::string& data, Options options) :
+    Reader(data.data(), data.size(), options)
+{}
+
+Reader::
+Reader(const MappedFile& file, Options options) :
+    Reader(file.data(), file.size(), options)
+{
+    if (file.error()) error_ = file.error();
+}
+
+char
+Reader::
+popStream()
+{
+    if (!stream) {
+        failed = true;
+        return EOF;
+    }
+
+    int c = stream->sbumpc();
+    if (c == EOF) failed = true;
+    else pos_++;
+
+    return c;
+}
+
+const char*
+Reader::
+lastNewline() const
+{
+    const char* it = cur_;
+    while (it != begin_) {
+        if (*--it == '\n') return it;
+    }
+    return nullptr;
+}
+
+size_t
+Reader::
+line() const
+{
+    if (stream) return line_;
+
+    size_t lines = 1;
+    const char* it = begin_;
+
+    while (it != cur_) {
+        it = static_cast<const char*>(std::memchr(it, '\n', cur_ - it));
+        if (!it) break;
+
+        ++lines;
+        ++it;
+    }
+
+    return lines;
+}
+
+size_t
+Reader::
+pos() const
+{
+    if (stream) return pos_;
+
+    const char* nl = lastNewline();
+    return (cur_ - (nl ? nl + 1 : begin_)) + 1;
+}
+
 Token
 Reader::
 peekToken()
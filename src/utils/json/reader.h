@@ -10,9 +10,43 @@ namespace reflect {
 namespace json {
 
 
+/******************************************************************************/
+/* MAPPED FILE                                                                */
+/******************************************************************************/
+
+// Read-only memory mapping of a file which can be handed to a Reader.
+struct MappedFile
+{
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    const Error& error() const { return error_; }
+
+private:
+    const char* data_;
+    size_t size_;
+    Error error_;
+};
+
+
 /******************************************************************************/
 /* READER                                                                     */
 /******************************************************************************/
+/** Reads either from a stream or from a contiguous range of bytes which must
+    outlive the reader.
+
+    Contiguous inputs are scanned through raw pointers, in bulk where possible
+    (see Scanner), and the position is only computed when it's requested,
+    typically when reporting an error.
+    Streams are read one character at a time through their streambuf which
+    avoids reading past the end of the json value.
+ */
 
 struct Reader
 {
@@ -26,23 +60,29 @@ struct Reader
         Default = UnescapeUnicode | ValidateUnicode,
     };
 
-    Reader(std::istream& stream, Options options = Default) :
-        stream(stream),
-        pos_(1), line_(1),
-        options(options)
-    {
-        buffer_.reserve(128);
-    }
+    Reader(std::istream& stream, Options options = Default);
+    Reader(const char* data, size_t size, Options options = Default);
+    Reader(const std::string& data, Options options = Default);
+    Reader(const MappedFile& file, Options options = Default);
 
-    bool ok() const { return !error_ && stream; }
+    bool ok() const { return !error_ && !failed; }
     operator bool() const { return ok(); }
 
     template<typename... Args>
     void error(const char* fmt, Args&&... args);
     const Error& error() const { return error_; }
 
-    char peek() { return stream.peek(); }
-    char pop() { pos_++; return stream.get(); }
+    char peek()
+    {
+        if (cur_ != end_) return *cur_;
+        return stream ? stream->sgetc() : EOF;
+    }
+
+    char pop()
+    {
+        if (cur_ != end_) return *cur_++;
+        return popStream();
+    }
 
     Token peekToken();
     Token nextToken();
@@ -50,22 +90,44 @@ struct Reader
     bool assertToken(const Token& token, Token::Type exp);
 
     void save(char c) { buffer_.push_back(c); }
+    void save(const char* data, size_t n) { buffer_.append(data, n); }
     const std::string& buffer() { return buffer_; }
     void resetBuffer() { buffer_.clear(); }
 
-    size_t pos() const { return pos_; }
-    size_t line() const { return line_; }
-    void newline() { pos_ = 1; line_++; }
+    size_t pos() const;
+    size_t line() const;
+    void newline() { if (stream) { pos_ = 1; line_++; } }
+
+    // Unread bytes of contiguous inputs which is always empty for streams.
+    // Lets the tokenizer scan through the input in bulk.
+    bool isContiguous() const { return !stream; }
+    const char* cur() const { return cur_; }
+    const char* end() const { return end_; }
+    void skip(const char* it) { cur_ = it; }
+    const Scanner& scanner() const { return *scanner_; }
 
     bool allowComments() const { return options & AllowComments; }
     bool unescapeUnicode() const { return options & UnescapeUnicode; }
     bool validateUnicode() const { return options & ValidateUnicode; }
 
 private:
-    std::istream& stream;
+    char popStream();
+
+    // Position of the last newline before cur_ or nullptr if there are none.
+    const char* lastNewline() const;
+
+    std::streambuf* stream;
+    bool failed;
+
+    const char* begin_;
+    const char* cur_;
+    const char* end_;
+    const Scanner* scanner_;
+
     std::string buffer_;
     Error error_;
 
+    // Only tracked for streams.
     size_t pos_;
     size_t line_;
 
@@ -21,7 +21,7 @@ error(const char* fmt, Args&&... args)
     if (error_) return;
 
     std::stringstream ss;
-    ss << line_ << ":" << pos_ << ": ";
+    ss << line() << ":" << pos() << ": ";
     ss << reflect::errorFormat(fmt, std::forward<Args>(args)...);
     error_ = Error(ss.str());
 }
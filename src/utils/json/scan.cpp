@@ -0,0 +1,238 @@
+/* scan.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+*/
+
+#include "json.h"
+
+namespace reflect {
+namespace json {
+
+/******************************************************************************/
+/* SCALAR                                                                     */
+/******************************************************************************/
+
+namespace {
+
+bool isSpace(char c)
+{
+    return c == ' ' || uint8_t(c - '\t') <= uint8_t('\r' - '\t');
+}
+
+const char* skipSpacesScalar(const char* it, const char* end)
+{
+    while (it != end && isSpace(*it)) ++it;
+    return it;
+}
+
+const char* skipStringScalar(const char* it, const char* end, bool utf8)
+{
+    for (; it != end; ++it) {
+        char c = *it;
+        if (c == '"' || c == '\\' || c == '\n') break;
+        if ((c & 0x80) && utf8) break;
+    }
+    return it;
+}
+
+const Scanner scalarScanner = {
+    ScanMode::Scalar, &skipSpacesScalar, &skipStringScalar
+};
+
+} // namespace anonymous
+
+
+/******************************************************************************/
+/* SSE2                                                                       */
+/******************************************************************************/
+
+#ifdef __x86_64__
+
+namespace {
+
+const char* skipSpacesSSE2(const char* it, const char* end)
+{
+    // Most tokens are separated by one or two spaces which isn't worth a
+    // vector load.
+    if (it == end || !isSpace(*it)) return it;
+
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i controls = _mm_set1_epi8('\r' - '\t');
+
+    for (; end - it >= 16; it += 16) {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+        // [\t, \r] is contiguous so an unsigned range check covers it.
+        __m128i t = _mm_sub_epi8(c, tab);
+        __m128i ws = _mm_or_si128(
+                _mm_cmpeq_epi8(_mm_min_epu8(t, controls), t),
+                _mm_cmpeq_epi8(c, space));
+
+        unsigned mask = ~unsigned(_mm_movemask_epi8(ws)) & 0xFFFF;
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return skipSpacesScalar(it, end);
+}
+
+const char* skipStringSSE2(const char* it, const char* end, bool utf8)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i escape = _mm_set1_epi8('\\');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const unsigned high = utf8 ? 0xFFFF : 0;
+
+    for (; end - it >= 16; it += 16) {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+        __m128i special = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(c, quote), _mm_cmpeq_epi8(c, escape)),
+                _mm_cmpeq_epi8(c, newline));
+
+        // movemask picks up the high bit of every byte which is exactly what
+        // flags non-ASCII bytes.
+        unsigned mask = _mm_movemask_epi8(special);
+        mask |= _mm_movemask_epi8(c) & high;
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return skipStringScalar(it, end, utf8);
+}
+
+const Scanner sse2Scanner = {
+    ScanMode::SSE2, &skipSpacesSSE2, &skipStringSSE2
+};
+
+} // namespace anonymous
+
+
+/******************************************************************************/
+/* AVX2                                                                       */
+/******************************************************************************/
+
+namespace {
+
+__attribute__((target("avx2")))
+const char* skipSpacesAVX2(const char* it, const char* end)
+{
+    if (it == end || !isSpace(*it)) return it;
+
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i controls = _mm256_set1_epi8('\r' - '\t');
+
+    for (; end - it >= 32; it += 32) {
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+
+        __m256i t = _mm256_sub_epi8(c, tab);
+        __m256i ws = _mm256_or_si256(
+                _mm256_cmpeq_epi8(_mm256_min_epu8(t, controls), t),
+                _mm256_cmpeq_epi8(c, space));
+
+        unsigned mask = ~unsigned(_mm256_movemask_epi8(ws));
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return skipSpacesSSE2(it, end);
+}
+
+__attribute__((target("avx2")))
+const char* skipStringAVX2(const char* it, const char* end, bool utf8)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i escape = _mm256_set1_epi8('\\');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const unsigned high = utf8 ? ~0U : 0;
+
+    for (; end - it >= 32; it += 32) {
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+
+        __m256i special = _mm256_or_si256(
+                _mm256_or_si256(
+                        _mm256_cmpeq_epi8(c, quote),
+                        _mm256_cmpeq_epi8(c, escape)),
+                _mm256_cmpeq_epi8(c, newline));
+
+        unsigned mask = _mm256_movemask_epi8(special);
+        mask |= _mm256_movemask_epi8(c) & high;
+        if (mask) return it + __builtin_ctz(mask);
+    }
+
+    return skipStringSSE2(it, end, utf8);
+}
+
+const Scanner avx2Scanner = {
+    ScanMode::AVX2, &skipSpacesAVX2, &skipStringAVX2
+};
+
+} // namespace anonymous
+
+#endif // __x86_64__
+
+
+/******************************************************************************/
+/* SCANNER                                                                    */
+/******************************************************************************/
+
+namespace {
+
+const Scanner* select(ScanMode mode)
+{
+    switch (mode) {
+#ifdef __x86_64__
+    case ScanMode::AVX2: return &avx2Scanner;
+    case ScanMode::SSE2: return &sse2Scanner;
+#endif
+    case ScanMode::Scalar: return &scalarScanner;
+    default: return nullptr;
+    }
+}
+
+std::atomic<const Scanner*>& currentScanner()
+{
+    static std::atomic<const Scanner*> current(select(detectScanMode()));
+    return current;
+}
+
+} // namespace anonymous
+
+ScanMode detectScanMode()
+{
+#ifdef __x86_64__
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return ScanMode::AVX2;
+    return ScanMode::SSE2;
+#else
+    return ScanMode::Scalar;
+#endif
+}
+
+const Scanner& scanner()
+{
+    return *currentScanner().load(std::memory_order_relaxed);
+}
+
+bool setScanMode(ScanMode mode)
+{
+    if (mode > detectScanMode()) return false;
+
+    const Scanner* scanner = select(mode);
+    if (!scanner) return false;
+
+    currentScanner().store(scanner, std::memory_order_relaxed);
+    return true;
+}
+
+std::string print(ScanMode mode)
+{
+    switch (mode) {
+    case ScanMode::Scalar: return "scalar";
+    case ScanMode::SSE2: return "sse2";
+    case ScanMode::AVX2: return "avx2";
+    default: reflectError("unknown scan mode");
+    }
+}
+
+} // namespace json
+} // namespace reflect
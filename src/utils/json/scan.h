@@ -0,0 +1,55 @@
+/* scan.h                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Bulk scanning of contiguous json inputs.
+*/
+
+#pragma once
+
+#include <string>
+
+namespace reflect {
+namespace json {
+
+/******************************************************************************/
+/* SCANNER                                                                    */
+/******************************************************************************/
+/** Routines used by the tokenizer to skip over runs of bytes that don't
+    require any processing when reading from a contiguous input. Each routine
+    returns the position of the first byte that needs to be looked at or end if
+    there are none.
+
+    The implementation is picked on first use based on the instruction sets
+    supported by the CPU and can be overridden which is mostly useful for
+    benchmarks and tests. Readers pick up the implementation that is current
+    when they're constructed.
+ */
+
+enum struct ScanMode { Scalar, SSE2, AVX2 };
+
+struct Scanner
+{
+    ScanMode mode;
+
+    // Skips over whitespace as defined by std::isspace in the C locale.
+    const char* (*skipSpaces)(const char* it, const char* end);
+
+    // Skips over the characters of a string up to the first quote, backslash
+    // or newline and, if utf8 is set, the first non-ASCII byte.
+    const char* (*skipString)(const char* it, const char* end, bool utf8);
+};
+
+const Scanner& scanner();
+
+// Best mode supported by the CPU.
+ScanMode detectScanMode();
+
+// Returns false and leaves the current mode untouched if the mode isn't
+// supported by the CPU.
+bool setScanMode(ScanMode mode);
+
+std::string print(ScanMode mode);
+
+} // namespace json
+} // namespace reflect
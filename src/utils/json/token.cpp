@@ -12,17 +12,35 @@ namespace json {
 
 Token::
 Token(Type type, const std::string& value) :
-    type_(type), value_(&value)
+    type_(type), data_(value.data()), size_(value.size()), int_(0)
+{}
+
+Token::
+Token(Type type, const char* data, size_t size) :
+    type_(type), data_(data), size_(size), int_(0)
+{}
+
+Token::
+Token(const char* data, size_t size, int64_t value) :
+    type_(Int), data_(data), size_(size), int_(value)
+{}
+
+Token::
+Token(const char* data, size_t size, double value) :
+    type_(Float), data_(data), size_(size), float_(value)
 {}
 
 namespace  {
-std::string trueValue = "true";
-std::string falseValue = "false";
+const char trueValue[] = "true";
+const char falseValue[] = "false";
 }
 
 Token::
 Token(Type type, bool value) :
-    type_(type), value_(value ? &trueValue : &falseValue)
+    type_(type),
+    data_(value ? trueValue : falseValue),
+    size_(value ? sizeof(trueValue) - 1 : sizeof(falseValue) - 1),
+    int_(0)
 {}
 
 bool
@@ -32,7 +50,7 @@ asBool() const
     if (type_ != Bool)
         reflectError("invalid conversion of token %s to <bool>", print());
 
-    return value_ == &trueValue;
+    return data_ == trueValue;
 }
 
 int64_t
@@ -42,27 +60,38 @@ asInt() const
     if (type_ != Int)
         reflectError("invalid conversion of token %s to <int>", print());
 
-    return std::stol(*value_);
+    return int_;
 }
 
 double
 Token::
 asFloat() const
 {
+    if (type_ == Int) return int_;
     if (type_ != Float)
         reflectError("invalid conversion of token %s to <float>", print());
 
-    return std::stod(*value_);
+    return float_;
 }
 
-const std::string&
+std::string
 Token::
 asString() const
 {
     if (type_ != String)
         reflectError("invalid conversion of token %s to <string>", print());
 
-    return *value_;
+    return std::string(data_, size_);
+}
+
+void
+Token::
+assignString(std::string& value) const
+{
+    if (type_ != String)
+        reflectError("invalid conversion of token %s to <string>", print());
+
+    value.assign(data_, size_);
 }
 
 std::string print(Token::Type type)
@@ -99,7 +128,10 @@ print() const
     std::stringstream ss;
 
     ss << "<Token " << reflect::json::print(type_);
-    if (value_) ss << ": " << *value_;
+    if (data_) {
+        ss << ": ";
+        ss.write(data_, size_);
+    }
     ss << ">";
 
     return ss.str();
@@ -112,9 +144,22 @@ print() const
 
 namespace {
 
+void skipComment(Reader& reader)
+{
+    if (reader.cur() != reader.end()) {
+        size_t n = reader.end() - reader.cur();
+        const void* nl = std::memchr(reader.cur(), '\n', n);
+        reader.skip(nl ? static_cast<const char*>(nl) : reader.end());
+    }
+
+    char c;
+    while (reader && (c = reader.pop()) != '\n') continue;
+}
+
 char nextChar(Reader& reader)
 {
     while (reader) {
+        reader.skip(reader.scanner().skipSpaces(reader.cur(), reader.end()));
         char c = reader.pop();
 
         if (c == '\n') reader.newline();
@@ -124,7 +169,7 @@ char nextChar(Reader& reader)
             if (!reader.allowComments())
                 reader.error("comments are not allowed");
 
-            while (reader && (c = reader.pop()) != '\n') continue;
+            skipComment(reader);
             continue;
         }
 
@@ -137,6 +182,14 @@ char nextChar(Reader& reader)
 
 void readLiteral(Reader& reader, const char* literal)
 {
+    size_t n = std::strlen(literal);
+    if (size_t(reader.end() - reader.cur()) >= n &&
+            !std::memcmp(reader.cur(), literal, n))
+    {
+        reader.skip(reader.cur() + n);
+        return;
+    }
+
     char c;
     const char* l = literal;
     while (reader && *l && (c = reader.pop()) == *l) l++;
@@ -214,9 +267,9 @@ void readUnicode(Reader& reader)
     if (reader && i != 4) reader.error("\\u requires 4 hex digits", i);
 }
 
-void validateUnicode(Reader& reader, char c)
+void validateUnicode(Reader& reader, char c, bool save)
 {
-    reader.save(c);
+    if (save) reader.save(c);
 
     size_t bytes = clz(~c);
     if (bytes > 4 || bytes < 2) reader.error("invalid UTF-8 header: %x", c);
@@ -225,7 +278,8 @@ void validateUnicode(Reader& reader, char c)
     uint32_t code = uint32_t(c) & mask;
 
     for (size_t i = 1; reader && i < bytes; i++) {
-        reader.save(c = reader.pop());
+        c = reader.pop();
+        if (save) reader.save(c);
         if ((c & 0xC0) != 0x80) reader.error("invalid UTF-8 encoding");
         code = (code << 6) | (c & 0x3F);
     }
@@ -239,12 +293,27 @@ void validateUnicode(Reader& reader, char c)
     reader.error("invalid UTF-8 encoding");
 }
 
-void readString(Reader& reader)
+// Strings without escapes read from a contiguous input are returned as a view
+// of the input. Everything else is unescaped into the reader's buffer.
+Token readString(Reader& reader)
 {
     reader.resetBuffer();
 
+    // Start of the string for as long as it can be referenced in place.
+    const char* view = reader.cur() != reader.end() ? reader.cur() : nullptr;
+
     while (reader) {
+        const char* it = reader.cur();
+        const char* end = reader.end();
+        const char* stop =
+            reader.scanner().skipString(it, end, reader.validateUnicode());
+        if (stop != it) {
+            if (!view) reader.save(it, stop - it);
+            reader.skip(stop);
+        }
+
         char c = reader.pop();
+        if (!reader) break;
 
         if (c == '\n') {
             reader.error("invalid \\n character in a string");
@@ -252,12 +321,21 @@ void readString(Reader& reader)
         }
 
         if ((c & 0x80) && reader.validateUnicode()) {
-            validateUnicode(reader, c);
+            validateUnicode(reader, c, !view);
             continue;
         }
 
-        if (c == '"') return;
+        if (c == '"') {
+            if (!view) return Token(Token::String, reader.buffer());
+            return Token(Token::String, view, reader.cur() - 1 - view);
+        }
+
         if (c == '\\') {
+            if (view) {
+                reader.save(view, reader.cur() - 1 - view);
+                view = nullptr;
+            }
+
             switch(c = reader.pop()) {
             case '"':
             case '/':
@@ -271,55 +349,126 @@ void readString(Reader& reader)
             case 'u': readUnicode(reader); continue;
             default:
                 reader.error("unknown escaped character <%c>", c);
-                return;
+                return Token(Token::String, reader.buffer());
             }
         }
 
-        reader.save(c);
+        if (!view) reader.save(c);
     };
 
     reader.error("unexpected end of string");
+    return Token(Token::String, reader.buffer());
 }
 
-Token::Type readNumber(Reader& reader, char c)
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// strtod honours the decimal point of the current locale while json always
+// uses a period so the fallback is pinned to the C locale.
+double parseDouble(const char* data, size_t size)
 {
-    Token::Type type = Token::Int;
+    static const locale_t locale = newlocale(LC_ALL_MASK, "C", 0);
+    return strtod_l(std::string(data, size).c_str(), nullptr, locale);
+}
+
+// Numbers are converted as they're read. Up to 19 significant digits are
+// accumulated which is enough to represent any int64_t exactly and to hand
+// floats to Eisel-Lemire. Floats that don't fit or that can't be rounded with
+// certainty fall back on strtod in the C locale.
+Token readNumber(Reader& reader, char c)
+{
+    enum { MaxDigits = 19 };
+
     reader.resetBuffer();
-    reader.save(c); // can be either - or [0-9].
 
-    auto readDigits = [&] {
-        while (reader && std::isdigit(c = reader.peek()))
-            reader.save(reader.pop());
-    };
+    // Contiguous inputs reference the text of the number in place.
+    const char* view = reader.isContiguous() ? reader.cur() - 1 : nullptr;
+    if (!view) reader.save(c); // can be either - or [0-9].
 
-    auto readChar = [&] (char c) {
-        if (!reader || reader.peek() != c) return false;
+    auto next = [&] {
+        char c = reader.pop();
+        if (!view) reader.save(c);
+        return c;
+    };
 
-        reader.save(reader.pop());
-        return true;
+    auto peekChars = [&] (char a, char b) {
+        if (!reader) return false;
+        char c = reader.peek();
+        return c == a || c == b;
+    };
+    auto peekChar = [&] (char a) { return peekChars(a, a); };
+
+    bool negative = c == '-';
+    bool truncated = false;
+    uint64_t mantissa = negative ? 0 : c - '0';
+    size_t digits = mantissa ? 1 : 0;
+    size_t read = negative ? 0 : 1;
+    int64_t exponent = 0;
+
+    auto readDigits = [&] (bool fraction) {
+        while (reader && isDigit(reader.peek())) {
+            unsigned digit = next() - '0';
+            read++;
+
+            if (digits < MaxDigits) {
+                mantissa = mantissa * 10 + digit;
+                if (mantissa) digits++;
+                if (fraction) exponent--;
+            }
+            else {
+                if (digit) truncated = true;
+                if (!fraction) exponent++;
+            }
+        }
     };
 
-    auto readChars = [&] (char a, char b) {
-        if (!reader || (reader.peek() != a && reader.peek() != b))
-            return false;
+    Token::Type type = Token::Int;
 
-        reader.save(reader.pop());
-        return true;
-    };
+    readDigits(false);
+    if (!read) reader.error("expected digits in number");
 
-    readDigits();
-    if (readChar('.')) {
+    if (peekChar('.')) {
+        next();
         type = Token::Float;
-        readDigits();
+        readDigits(true);
     }
 
-    if (readChars('e', 'E')) {
+    if (peekChars('e', 'E')) {
+        next();
         type = Token::Float;
-        readChars('+', '-');
-        readDigits();
+
+        bool negativeExp = false;
+        if (peekChars('+', '-')) negativeExp = next() == '-';
+
+        // Clamped well beyond the range of double to avoid overflows.
+        int64_t exp = 0;
+        while (reader && isDigit(reader.peek())) {
+            exp = std::min<int64_t>(exp * 10 + (next() - '0'), 100000);
+        }
+        exponent += negativeExp ? -exp : exp;
     }
 
-    return type;
+    const char* data = view ? view : reader.buffer().data();
+    size_t size = view ? reader.cur() - view : reader.buffer().size();
+
+    if (type == Token::Int) {
+        uint64_t limit = std::numeric_limits<int64_t>::max();
+        if (truncated || exponent || mantissa > limit + negative) {
+            reader.error("integer <%s> overflows int64_t",
+                    std::string(data, size));
+            return Token(data, size, int64_t(0));
+        }
+
+        // Negated in two steps to avoid overflowing on the minimum value.
+        int64_t value = mantissa;
+        if (negative && mantissa) value = -int64_t(mantissa - 1) - 1;
+        return Token(data, size, value);
+    }
+
+    double value;
+    if (truncated || !eiselLemire(mantissa, exponent, negative, value))
+        value = parseDouble(data, size);
+
+    return Token(data, size, value);
 }
 
 } // namespace anonymous
@@ -348,9 +497,7 @@ Token nextToken(Reader& reader)
     case 't': readLiteral(reader, "rue");  return Token(Token::Bool, true);
     case 'f': readLiteral(reader, "alse"); return Token(Token::Bool, false);
 
-    case '"':
-        readString(reader);
-        return Token(Token::String, reader.buffer());
+    case '"': return readString(reader);
 
     case '-':
     case '0':
@@ -363,10 +510,7 @@ Token nextToken(Reader& reader)
     case '7':
     case '8':
     case '9':
-    {
-        Token::Type type = readNumber(reader, c);
-        return Token(type, reader.buffer());
-    }
+        return readNumber(reader, c);
     default:
         reader.error("unexpected character <%c>", c);
         return Token(Token::EOS);
@@ -14,6 +14,12 @@ namespace json {
 /* TOKEN                                                                      */
 /******************************************************************************/
 
+/** The value of a token is a view which either points directly into the input
+    of the reader, for strings without escapes read from a contiguous input,
+    or into the reader's buffer. Either way it's only valid until the next
+    token is read. Number tokens also carry their converted value.
+ */
+
 struct Token
 {
     enum Type
@@ -27,23 +33,39 @@ struct Token
         EOS
     };
 
-    Token() : type_(NoToken), value_(nullptr) {}
-    Token(Type type) : type_(type), value_(nullptr) {}
+    Token() : type_(NoToken), data_(nullptr), size_(0), int_(0) {}
+    Token(Type type) : type_(type), data_(nullptr), size_(0), int_(0) {}
     Token(Type type, bool value);
     Token(Type type, const std::string& value);
+    Token(Type type, const char* data, size_t size);
+    Token(const char* data, size_t size, int64_t value);
+    Token(const char* data, size_t size, double value);
 
     Type type() const { return type_; }
 
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
     bool asBool() const;
     int64_t asInt() const;
     double asFloat() const;
-    const std::string& asString() const;
+    std::string asString() const;
+
+    // Assigns the string to value which reuses its storage.
+    void assignString(std::string& value) const;
 
     std::string print() const;
 
 private:
     Type type_;
-    const std::string* value_;
+    const char* data_;
+    size_t size_;
+
+    union
+    {
+        int64_t int_;
+        double float_;
+    };
 };
 
 std::string print(Token::Type type);
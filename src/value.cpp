@@ -15,25 +15,23 @@ namespace reflect {
 /******************************************************************************/
 
 Value::
-Value() : value_(nullptr) {}
+Value() : value_(nullptr), box_(nullptr) {}
 
 // This is required to avoid trigerring the templated constructor for Value when
 // trying to copy non-const Values. This is common in data-structures like
 // vectors where entries would get infinitely wrapped in layers of Values
 // everytime a resize takes place.
 Value::
-Value(Value& other) :
-    arg(other.arg),
-    value_(other.value_),
-    storage(other.storage)
-{}
+Value(Value& other) : arg(other.arg)
+{
+    copyFrom(other);
+}
 
 Value::
-Value(const Value& other) :
-    arg(other.arg),
-    value_(other.value_),
-    storage(other.storage)
-{}
+Value(const Value& other) : arg(other.arg)
+{
+    copyFrom(other);
+}
 
 Value&
 Value::
@@ -41,19 +39,18 @@ operator=(const Value& other)
 {
     if (this == &other) return *this;
 
+    release();
     arg = other.arg;
-    value_ = other.value_;
-    storage = other.storage;
+    copyFrom(other);
 
     return *this;
 }
 
 Value::
-Value(Value&& other) :
-    arg(std::move(other.arg)),
-    value_(std::move(other.value_)),
-    storage(std::move(other.storage))
-{}
+Value(Value&& other) : arg(std::move(other.arg))
+{
+    moveFrom(other);
+}
 
 Value&
 Value::
@@ -61,13 +58,70 @@ operator=(Value&& other)
 {
     if (this == &other) return *this;
 
+    release();
     arg = std::move(other.arg);
-    value_ = std::move(other.value_);
-    storage = std::move(other.storage);
+    moveFrom(other);
 
     return *this;
 }
 
+Value::
+~Value()
+{
+    release();
+}
+
+void
+Value::
+copyFrom(const Value& other)
+{
+    if (other.isInline()) {
+        inline_ = other.inline_;
+        value_ = &inline_;
+        return;
+    }
+
+    value_ = other.value_;
+    box_ = other.box_;
+    if (box_) box_->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+Value::
+moveFrom(Value& other)
+{
+    if (other.isInline()) {
+        inline_ = other.inline_;
+        value_ = &inline_;
+        return;
+    }
+
+    value_ = other.value_;
+    box_ = other.box_;
+    other.box_ = nullptr;
+}
+
+void
+Value::
+release()
+{
+    if (isInline() || !box_) return;
+
+    if (box_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        box_->free(box_);
+    box_ = nullptr;
+}
+
+Value
+Value::
+ref() const
+{
+    Value result;
+    result.arg = arg;
+    result.value_ = value_;
+    return result;
+}
+
 const std::string&
 Value::
 typeId() const
@@ -82,6 +136,13 @@ is(const std::string& trait) const
     return type()->is(trait);
 }
 
+bool
+Value::
+is(Symbol trait) const
+{
+    return type()->is(trait);
+}
+
 
 Value
 Value::
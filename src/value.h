@@ -3,6 +3,20 @@
    FreeBSD-style copyright and disclaimer apply
 
    Value front-end.
+
+   Values that own their object store it in one of two ways. Small trivially
+   copyable objects are kept inline in the Value and are copied along with it,
+   which means that no allocations or atomic operations are required. Anything
+   else is allocated in a single block alongside an intrusive ref count that is
+   shared by all the copies of the Value.
+
+   As with the small object storage of std::any, copies of an inline Value
+   don't alias its object and moving or destroying the Value invalidates any
+   pointer into its inline storage. This includes the addresses returned by
+   value(), get(), as() and field() as well as ValueRefs to the Value.
+
+   Since copying an inline Value also copies its object, the call machinery
+   passes arguments around as non-owning references created through ref().
 */
 
 #include "reflect.h"
@@ -35,6 +49,20 @@ struct CleanValue
 };
 
 
+/******************************************************************************/
+/* VALUE BOX                                                                  */
+/******************************************************************************/
+
+// Header of the heap allocated storage of a Value.
+struct ValueBox
+{
+    explicit ValueBox(void (*free)(ValueBox*)) : refs(1), free(free) {}
+
+    std::atomic<size_t> refs;
+    void (*free)(ValueBox*);
+};
+
+
 /******************************************************************************/
 /* VALUE OP                                                                   */
 /******************************************************************************/
@@ -87,22 +115,30 @@ struct Value
     Value(Value&& other);
     Value& operator=(Value&& other);
 
+    ~Value();
+
     void* value() const { return value_; }
     const Type* type() const { return arg.type(); }
     const std::string& typeId() const;
     RefType refType() const { return arg.refType(); }
     bool isConst() const { return arg.isConst(); }
     bool isVoid() const { return arg.isVoid(); }
-    bool isStored() const { return !!storage; }
+    bool isStored() const { return isInline() || box_; }
+    bool isInline() const { return value_ == &inline_; }
 
     const Argument& argument() const { return arg; }
 
     bool is(const std::string& trait) const;
+    bool is(Symbol trait) const;
 
     // Get a reference to the value without any type checks.
     template<typename T> T& as();
     template<typename T> const T& get() const;
 
+    // Non-owning Value that refers to the same object. Only valid as long as
+    // this Value is alive and isn't moved.
+    Value ref() const;
+
     Value toConst() const;
     Value rvalue() const;
     Value copy() const;
@@ -111,9 +147,15 @@ struct Value
     template<typename Ret, typename... Args>
     Ret call(const std::string& fn, Args&&... args) const;
 
+    template<typename Ret, typename... Args>
+    Ret call(Symbol fn, Args&&... args) const;
+
     template<typename Ret = Value>
     Ret field(const std::string& field) const;
 
+    template<typename Ret = Value>
+    Ret field(Symbol field) const;
+
     // operator= for the contained value.
     template<typename Arg>
     void assign(Arg&& arg) const;
@@ -167,10 +209,42 @@ struct Value
     explicit operator bool() const;
 
 private:
+    friend struct ValueRef;
+
+    typedef std::aligned_storage<16, alignof(void*)>::type Inline;
+
+    template<typename T>
+    struct IsInline
+    {
+        static constexpr bool value =
+            sizeof(T) <= sizeof(Inline) &&
+            alignof(T) <= alignof(Inline) &&
+            std::is_trivially_copyable<T>::value;
+
+        typedef std::integral_constant<bool, value> type;
+    };
+
+    template<typename T, typename Arg>
+    void store(Arg&& value, std::true_type);
+
+    template<typename T, typename Arg>
+    void store(Arg&& value, std::false_type);
+
+    void copyFrom(const Value& other);
+    void moveFrom(Value& other);
+    void release();
+
+    template<typename Ret>
+    Ret fieldValue(const Field& field) const;
 
     Argument arg;
     void* value_;
-    std::shared_ptr<void> storage;
+
+    union
+    {
+        ValueBox* box_;
+        Inline inline_;
+    };
 };
 
 
@@ -24,62 +24,111 @@ struct IsMovable
     typedef std::integral_constant<bool, value> type;
 };
 
-template<typename T>
-struct ValueDestructor
-{
-    void operator() (void* ptr) const
-    {
-        delete static_cast<T*>(ptr);
-    }
-};
-
-
 /******************************************************************************/
 /* VALUE                                                                      */
 /******************************************************************************/
 
 template<typename T, typename Meh>
-void* store(T&& value, std::true_type, Meh)
+void store(void* dst, T&& value, std::true_type, Meh)
 {
     typedef typename std::decay<T>::type CleanT;
-    return new CleanT(std::move(value));
+    new (dst) CleanT(std::move(value));
 }
 
 template<typename T>
-void* store(T&& value, std::false_type, std::true_type)
+void store(void* dst, T&& value, std::false_type, std::true_type)
 {
     typedef typename std::decay<T>::type CleanT;
-    return new CleanT(value);
+    new (dst) CleanT(value);
 }
 
 template<typename T, typename... Rest>
-void* store(Rest&&...)
+void store(Rest&&...)
 {
     reflectError(
             "<%s> cannot be stored (no move/copy constructor)",
             printArgument<T>());
 }
 
+template<typename T>
+struct ValueBoxImpl
+{
+    explicit ValueBoxImpl(void (*free)(ValueBox*)) : header(free) {}
+
+    // Boxes are taken out of the thread's arena if one is installed in which
+    // case they're reclaimed along with the arena. Loaders are skipped as the
+    // values they create are owned by the registry and outlive the arena.
+    static ValueBoxImpl* make()
+    {
+        Arena* arena = ArenaScope::current();
+        if (!arena || Registry::isLoading() ||
+                alignof(ValueBoxImpl) > alignof(std::max_align_t))
+            return new ValueBoxImpl(&free);
+
+        void* ptr =
+            arena->allocate(sizeof(ValueBoxImpl), alignof(ValueBoxImpl));
+        return new (ptr) ValueBoxImpl(&destroy);
+    }
+
+    static void free(ValueBox* box)
+    {
+        auto impl = reinterpret_cast<ValueBoxImpl*>(box);
+        reinterpret_cast<T*>(&impl->value)->~T();
+        delete impl;
+    }
+
+    static void destroy(ValueBox* box)
+    {
+        auto impl = reinterpret_cast<ValueBoxImpl*>(box);
+        reinterpret_cast<T*>(&impl->value)->~T();
+        impl->~ValueBoxImpl();
+    }
+
+    ValueBox header;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type value;
+};
+
 template<typename T>
 Value::
 Value(T&& value) :
     arg(Argument::make(std::forward<T>(value))),
-    value_((void*)&value) // cast-away any const
+    value_((void*)&value), // cast-away any const
+    box_(nullptr)
 {
     if (refType() != RefType::RValue) return;
 
     typedef typename std::decay<T>::type CleanT;
-
-    value_ = store<T>(std::forward<T>(value),
-            typename IsMovable<T>::type(),
-            typename std::is_copy_constructible<CleanT>::type());
-
-    storage.reset(value_, ValueDestructor<CleanT>());
+    store<CleanT>(std::forward<T>(value), typename IsInline<CleanT>::type());
 
     // We now own the value so we're now l-ref-ing our internal storage.
     arg = Argument(arg.type(), RefType::LValue, false);
 }
 
+template<typename T, typename Arg>
+void
+Value::
+store(Arg&& value, std::true_type)
+{
+    value_ = &inline_;
+    reflect::store<Arg>(value_, std::forward<Arg>(value),
+            typename IsMovable<Arg>::type(),
+            typename std::is_copy_constructible<T>::type());
+}
+
+template<typename T, typename Arg>
+void
+Value::
+store(Arg&& value, std::false_type)
+{
+    auto box = ValueBoxImpl<T>::make();
+    reflect::store<Arg>((void*) &box->value, std::forward<Arg>(value),
+            typename IsMovable<Arg>::type(),
+            typename std::is_copy_constructible<T>::type());
+
+    box_ = &box->header;
+    value_ = &box->value;
+}
+
 template<typename T>
 T&
 Value::
@@ -116,17 +165,41 @@ call(const std::string& fn, Args&&... args) const
     return f.call<Ret>(*this, std::forward<Args>(args)...);
 }
 
+template<typename Ret, typename... Args>
+Ret
+Value::
+call(Symbol fn, Args&&... args) const
+{
+    const auto& f = type()->function(fn);
+    return f.call<Ret>(*this, std::forward<Args>(args)...);
+}
+
 template<typename Ret>
 Ret
 Value::
 field(const std::string& field) const
 {
-    const auto& f = type()->field(field);
-    bool isConst = f.argument().isConst() || this->isConst();
+    return fieldValue<Ret>(type()->field(field));
+}
+
+template<typename Ret>
+Ret
+Value::
+field(Symbol field) const
+{
+    return fieldValue<Ret>(type()->field(field));
+}
+
+template<typename Ret>
+Ret
+Value::
+fieldValue(const Field& field) const
+{
+    bool isConst = field.argument().isConst() || this->isConst();
 
     Value value;
-    value.arg = Argument(f.type(), RefType::LValue, isConst);
-    value.value_ = static_cast<uint8_t*>(value_) + f.offset();
+    value.arg = Argument(field.type(), RefType::LValue, isConst);
+    value.value_ = static_cast<uint8_t*>(value_) + field.offset();
 
     return retCast<Ret>(value);
 }
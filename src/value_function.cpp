@@ -13,19 +13,62 @@ namespace reflect {
 /* VALUE FUNCTION                                                             */
 /******************************************************************************/
 
+namespace {
+
+// Prefixed to every value function to remember where it was allocated and
+// how many Functions share it.
+struct alignas(std::max_align_t) ValueFunctionHeader
+{
+    std::atomic<size_t> refs;
+    size_t size;
+    bool isMeta;
+};
+
+} // namespace anonymous
+
+// Value functions created while loading a type are part of its metadata and
+// are therefore allocated in the registry's arena.
 void* allocValueFunction(size_t size)
 {
-    return std::malloc(size);
+    typedef ValueFunctionHeader Header;
+
+    bool isMeta = Registry::isLoading();
+    size_t total = sizeof(Header) + size;
+
+    void* ptr = isMeta ?
+        Registry::allocate(MetaCategory::Functions, total, alignof(Header)) :
+        std::malloc(total);
+
+    Header* header = new (ptr) Header();
+    header->refs.store(1, std::memory_order_relaxed);
+    header->size = total;
+    header->isMeta = isMeta;
+
+    return header + 1;
+}
+
+void* retainValueFunction(void* fn)
+{
+    if (!fn) return nullptr;
+
+    auto header = static_cast<ValueFunctionHeader*>(fn) - 1;
+    header->refs.fetch_add(1, std::memory_order_relaxed);
+    return fn;
 }
 
 void freeValueFunction(void* fn)
 {
     if (!fn) return;
 
+    auto header = static_cast<ValueFunctionHeader*>(fn) - 1;
+    if (header->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
     typedef ValueFunction<0> Fn;
     static_cast<Fn*>(fn)->free();
 
-    free(fn);
+    if (header->isMeta)
+        Registry::deallocate(MetaCategory::Functions, header->size);
+    else std::free(header);
 }
 
 void
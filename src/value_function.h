@@ -19,6 +19,18 @@
    Value object before being returned which means that any temporaries will be
    stored in Value and is therefor safe to use by the caller.
 
+   Alongside the Value interface, each function also gets a TypedFunction
+   trampoline which takes the exact argument types of the reflected function
+   and forwards them as is. Callers whose static signature is identical to the
+   reflected one can go through it and skip Value entirely.
+
+   Finally, invoke() takes its arguments as an array of Value whose size is
+   only known at runtime. Since the vtable layout is the same for all arities,
+   callers can go through ValueFunction<0> just like free() does.
+
+   callInto() constructs the return value directly in storage provided by the
+   caller instead of boxing it in a Value. References are returned by copy.
+
 */
 
 #include "reflect.h"
@@ -47,6 +59,10 @@ struct ValueFunctionBase< TypeVector<Values...> >
         job for the compiler...
      */
     virtual void free() = 0;
+
+    virtual void invoke(const Value* values, Value& ret) = 0;
+
+    virtual void callInto(void* dst, Values... values) = 0;
 };
 
 
@@ -71,6 +87,8 @@ struct ValueFunctionImpl< Fn, TypeVector<Values...> > :
 
     ValueFunctionImpl(Fn fn) : fn(std::move(fn)) {}
 
+    Fn& function() { return fn; }
+
     // Compile-time optimization. See ValueFunctionBase::free()
     virtual void free() { this->~ValueFunctionImpl(); }
 
@@ -81,9 +99,56 @@ struct ValueFunctionImpl< Fn, TypeVector<Values...> > :
         return call(IsVoidRet(), values...);
     }
 
+    virtual void invoke(const Value* values, Value& ret)
+    {
+        typedef typename MakeIndexes<sizeof...(Values)>::type Indexes;
+        invoke(values, ret, Indexes());
+    }
+
+    virtual void callInto(void* dst, Values... values)
+    {
+        typedef typename std::is_same<Ret, void>::type IsVoidRet;
+        typedef typename std::decay<Ret>::type CleanRet;
+        typedef typename std::is_constructible<CleanRet, Ret>::type IsCopyRet;
+
+        callInto(IsVoidRet(), IsCopyRet(), dst, values...);
+    }
+
 
 private:
 
+    // cast() takes its Value by copy so the values are never modified.
+    template<size_t... I>
+    void invoke(const Value* values, Value& ret, IndexVector<I...>)
+    {
+        typedef typename std::is_same<Ret, void>::type IsVoidRet;
+
+        (void) values;
+        ret = call(IsVoidRet(), const_cast<Value&>(values[I])...);
+    }
+
+    template<typename IsCopyRet>
+    void callInto(std::true_type, IsCopyRet, void*, Values&... values)
+    {
+        call(std::true_type(), values...);
+    }
+
+    void callInto(std::false_type, std::true_type, void* dst, Values&... values)
+    {
+        typedef typename FnType::type type;
+        typedef typename FnType::Arguments Args;
+        typedef typename std::decay<Ret>::type CleanRet;
+
+        new (dst) CleanRet(call(type(), Args(), values...));
+    }
+
+    void callInto(std::false_type, std::false_type, void*, Values&...)
+    {
+        reflectError("<%s> can't be constructed from <%s>",
+                printArgument<typename std::decay<Ret>::type>(),
+                printArgument<Ret>());
+    }
+
     Value call(std::true_type, Values&... values)
     {
         typedef typename FnType::type type;
@@ -134,6 +199,87 @@ private:
 };
 
 
+/******************************************************************************/
+/* SIGNATURE ID                                                               */
+/******************************************************************************/
+
+// Unique address for each function signature. If an instance ends up being
+// duplicated across shared objects then we just won't take the fast path.
+template<typename Sig>
+struct SignatureId
+{
+    static const char id;
+};
+
+template<typename Sig>
+const char SignatureId<Sig>::id = 0;
+
+template<typename Sig>
+const void* signatureId()
+{
+    return &SignatureId<Sig>::id;
+}
+
+
+/******************************************************************************/
+/* TYPED FUNCTION                                                             */
+/******************************************************************************/
+
+typedef void (*TypedFunctionPtr)();
+
+template<typename Fn, typename Args> struct TypedFunctionImpl;
+
+template<typename Fn, typename... Args>
+struct TypedFunctionImpl< Fn, TypeVector<Args...> >
+{
+    typedef FunctionType<Fn> FnType;
+    typedef typename FnType::Return Ret;
+
+    typedef Ret (*type)(void*, Args...);
+
+    static Ret invoke(void* fn, Args... args)
+    {
+        return call(typename FnType::type(),
+                *static_cast<Fn*>(fn), std::forward<Args>(args)...);
+    }
+
+private:
+
+    template<typename... Rest>
+    static Ret call(GlobalFunction, Fn& fn, Rest&&... args)
+    {
+        return (*fn)(std::forward<Rest>(args)...);
+    }
+
+    template<typename Obj, typename... Rest>
+    static Ret call(MemberFunction, Fn& fn, Obj&& obj, Rest&&... args)
+    {
+        return (obj.*fn)(std::forward<Rest>(args)...);
+    }
+
+    template<typename... Rest>
+    static Ret call(FunctorFunction, Fn& fn, Rest&&... args)
+    {
+        return fn(std::forward<Rest>(args)...);
+    }
+};
+
+template<typename Fn>
+struct TypedFunction :
+        public TypedFunctionImpl<Fn, typename FunctionType<Fn>::Arguments>
+{
+    static const void* id()
+    {
+        return signatureId<typename FunctionType<Fn>::Fn>();
+    }
+
+    static TypedFunctionPtr ptr()
+    {
+        return reinterpret_cast<TypedFunctionPtr>(&TypedFunction::invoke);
+    }
+};
+
+
 /******************************************************************************/
 /* MAKE VALUE FUNCTION                                                        */
 /******************************************************************************/
@@ -147,7 +293,11 @@ struct MakeValueFunction
 };
 
 
+// Value functions are ref counted so that they can be shared by copies of a
+// Function. freeValueFunction only frees the function along with its last
+// reference.
 void* allocValueFunction(size_t size);
+void* retainValueFunction(void* fn);
 void freeValueFunction(void* fn);
 
 template<typename Fn>
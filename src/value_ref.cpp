@@ -0,0 +1,128 @@
+/* value_ref.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   ValueRef implementation.
+*/
+
+#include "reflect.h"
+
+namespace reflect {
+
+
+/******************************************************************************/
+/* VALUE REF                                                                  */
+/******************************************************************************/
+
+static_assert(sizeof(ValueRef) == 2 * sizeof(void*), "ValueRef is too big");
+static_assert(std::is_trivially_copyable<ValueRef>::value,
+        "ValueRef must be trivially copyable");
+
+uintptr_t
+ValueRef::
+pack(const Type* type, RefType refType, bool isConst)
+{
+    static_assert(alignof(Type) > ConstMask, "Type isn't aligned enough");
+
+    return reinterpret_cast<uintptr_t>(type)
+        | uintptr_t(refType)
+        | (isConst ? uintptr_t(ConstMask) : 0);
+}
+
+ValueRef::
+ValueRef(const Argument& arg, void* value) :
+    bits(pack(arg.type(), arg.refType(), arg.isConst())),
+    value_(value)
+{}
+
+ValueRef::
+ValueRef(const Value& value) :
+    bits(pack(value.type(), value.refType(), value.isConst())),
+    value_(value.value())
+{}
+
+Argument
+ValueRef::
+argument() const
+{
+    return Argument(type(), refType(), isConst());
+}
+
+const std::string&
+ValueRef::
+typeId() const
+{
+    return type()->id();
+}
+
+bool
+ValueRef::
+isVoid() const
+{
+    return !type() || type() == reflect::type<void>();
+}
+
+bool
+ValueRef::
+is(const std::string& trait) const
+{
+    return type()->is(trait);
+}
+
+bool
+ValueRef::
+is(Symbol trait) const
+{
+    return type()->is(trait);
+}
+
+Value
+ValueRef::
+toValue() const
+{
+    Value result;
+    result.arg = argument();
+    result.value_ = value_;
+    return result;
+}
+
+ValueRef
+ValueRef::
+toConst() const
+{
+    ValueRef result(*this);
+    result.bits |= ConstMask;
+    return result;
+}
+
+ValueRef
+ValueRef::
+field(const std::string& field) const
+{
+    return fieldRef(type()->field(field));
+}
+
+ValueRef
+ValueRef::
+field(const char* field, size_t len) const
+{
+    return fieldRef(type()->field(field, len));
+}
+
+ValueRef
+ValueRef::
+field(Symbol field) const
+{
+    return fieldRef(type()->field(field));
+}
+
+ValueRef
+ValueRef::
+fieldRef(const Field& field) const
+{
+    bool isConst = field.argument().isConst() || this->isConst();
+    void* value = static_cast<uint8_t*>(value_) + field.offset();
+    return ValueRef(Argument(field.type(), RefType::LValue, isConst), value);
+}
+
+} // reflect
@@ -0,0 +1,135 @@
+/* value_ref.h                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Non-owning view of a reflected object.
+
+   Unlike Value, a ValueRef never owns the object it points to which allows it
+   to be trivially copyable and to fit in two words: the ref type and the
+   constness are packed into the low bits of the Type pointer. It's meant to
+   be passed around by value on paths that only borrow objects and must never
+   outlive the object it refers to.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* VALUE REF                                                                  */
+/******************************************************************************/
+
+struct ValueRef
+{
+    ValueRef() : bits(0), value_(nullptr) {}
+    ValueRef(const Argument& arg, void* value);
+
+    // Borrows the object of the value which must outlive the ref.
+    ValueRef(const Value& value);
+
+    template<typename T, typename = typename std::enable_if<
+                 !std::is_same<typename std::decay<T>::type, Value>::value &&
+                 !std::is_same<typename std::decay<T>::type, ValueRef>::value
+                 >::type>
+    explicit ValueRef(T& value);
+
+    void* value() const { return value_; }
+    const Type* type() const
+    {
+        return reinterpret_cast<const Type*>(bits & TypeMask);
+    }
+    const std::string& typeId() const;
+    RefType refType() const { return RefType(bits & RefTypeMask); }
+    bool isConst() const { return bits & ConstMask; }
+    bool isVoid() const;
+
+    Argument argument() const;
+
+    bool is(const std::string& trait) const;
+    bool is(Symbol trait) const;
+
+    // Reference to the object which must be a T or a child of T. Mutable
+    // access to a const ref is an error just like casting a const Value to a
+    // non-const reference.
+    template<typename T> T& as() const;
+    template<typename T> const T& get() const;
+
+    // Non-owning Value that refers to the same object.
+    Value toValue() const;
+    ValueRef toConst() const;
+
+    template<typename Ret, typename... Args>
+    Ret call(const std::string& fn, Args&&... args) const;
+
+    template<typename Ret, typename... Args>
+    Ret call(Symbol fn, Args&&... args) const;
+
+    ValueRef field(const std::string& field) const;
+    ValueRef field(const char* field, size_t len) const;
+    ValueRef field(Symbol field) const;
+
+    // operator= for the referenced value.
+    template<typename Arg>
+    void assign(Arg&& arg) const;
+
+private:
+
+    enum : uintptr_t
+    {
+        RefTypeMask = 0x3,
+        ConstMask = 0x4,
+        TypeMask = ~uintptr_t(0x7),
+    };
+
+    static uintptr_t pack(const Type* type, RefType refType, bool isConst);
+
+    ValueRef fieldRef(const Field& field) const;
+
+    uintptr_t bits;
+    void* value_;
+};
+
+
+/******************************************************************************/
+/* CAST                                                                       */
+/******************************************************************************/
+
+template<typename Target>
+struct Cast<ValueRef, Target>
+{
+    typedef typename details::TargetRef<Target>::type TargetRef;
+
+    static bool isCastable(ValueRef value)
+    {
+        return Cast<Value, Target>::isCastable(value.toValue());
+    }
+
+    static TargetRef cast(ValueRef value)
+    {
+        return Cast<Value, Target>::cast(value.toValue());
+    }
+};
+
+template<>
+struct Cast<ValueRef, Value>
+{
+    static bool isCastable(ValueRef) { return true; }
+    static Value cast(ValueRef value) { return value.toValue(); }
+};
+
+template<>
+struct Cast<ValueRef, ValueRef>
+{
+    static bool isCastable(ValueRef) { return true; }
+    static ValueRef cast(ValueRef value) { return value; }
+};
+
+template<>
+struct Cast<Value, ValueRef>
+{
+    static bool isCastable(const Value&) { return true; }
+    static ValueRef cast(const Value& value) { return ValueRef(value); }
+};
+
+} // reflect
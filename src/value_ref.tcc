@@ -0,0 +1,76 @@
+/* value_ref.tcc                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Template implementation for ValueRef.
+*/
+
+#include "reflect.h"
+#pragma once
+
+namespace reflect {
+
+/******************************************************************************/
+/* VALUE REF                                                                  */
+/******************************************************************************/
+
+template<typename T, typename>
+ValueRef::
+ValueRef(T& value) :
+    bits(pack(reflect::type<T>(), RefType::LValue, std::is_const<T>::value)),
+    value_((void*) &value) // cast-away any const
+{}
+
+template<typename T>
+T&
+ValueRef::
+as() const
+{
+    if (isConst()) {
+        reflectError("<%s> is not castable to <%s>",
+                argument().print(), printArgument<T&>());
+    }
+
+    return const_cast<T&>(get<T>());
+}
+
+template<typename T>
+const T&
+ValueRef::
+get() const
+{
+    if (!type()->isChildOf<T>()) {
+        reflectError("<%s> is not a base of <%s>",
+                type()->id(), reflect::type<T>()->id());
+    }
+
+    return *static_cast<const T*>(value_);
+}
+
+template<typename Ret, typename... Args>
+Ret
+ValueRef::
+call(const std::string& fn, Args&&... args) const
+{
+    const auto& f = type()->function(fn);
+    return f.call<Ret>(*this, std::forward<Args>(args)...);
+}
+
+template<typename Ret, typename... Args>
+Ret
+ValueRef::
+call(Symbol fn, Args&&... args) const
+{
+    const auto& f = type()->function(fn);
+    return f.call<Ret>(*this, std::forward<Args>(args)...);
+}
+
+template<typename Arg>
+void
+ValueRef::
+assign(Arg&& arg) const
+{
+    call<void>("operator=", std::forward<Arg>(arg));
+}
+
+} // reflect
@@ -0,0 +1,240 @@
+/* alloc_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Counts the heap allocations made on the reflected call path.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include "tests.h"
+#include "reflect.h"
+#include "test_types.h"
+#include "types/primitives.h"
+#include "types/std/string.h"
+
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* ALLOCATIONS                                                                */
+/******************************************************************************/
+
+namespace {
+
+std::atomic<size_t> allocations(0);
+
+struct CountAllocs
+{
+    CountAllocs() : start(allocations.load()) {}
+    size_t count() const { return allocations.load() - start; }
+
+private:
+    size_t start;
+};
+
+} // namespace anonymous
+
+void* operator new(size_t size)
+{
+    allocations++;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(call)
+{
+    test::Object obj(10);
+    Value value(obj);
+
+    int i = 1;
+    for (size_t j = 0; j < 2; ++j) {
+        value.call<int&>("ref");
+        value.call<void>("ref", i);
+        value.call<Value>("operator+=", i);
+    }
+
+    CountAllocs allocs;
+    for (size_t j = 0; j < 100; ++j) {
+        value.call<int&>("ref");
+        value.call<void>("ref", i);
+        value.call<Value>("operator+=", i);
+    }
+
+    BOOST_CHECK_EQUAL(allocs.count(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(invoke)
+{
+    test::Object obj(10);
+    int i = 1;
+
+    std::vector<Value> args;
+    args.emplace_back(obj);
+    args.emplace_back(i);
+
+    Value ret;
+    const auto& fns = type<test::Object>()->function("operator+=");
+    for (size_t j = 0; j < 2; ++j) fns.invoke(args.data(), args.size(), ret);
+
+    CountAllocs allocs;
+    for (size_t j = 0; j < 100; ++j) fns.invoke(args.data(), args.size(), ret);
+
+    BOOST_CHECK_EQUAL(allocs.count(), 0u);
+    BOOST_CHECK_EQUAL(obj.value, 112);
+}
+
+// Exact signatures go through the typed trampoline so even a return by value
+// doesn't need to be boxed.
+BOOST_AUTO_TEST_CASE(typed)
+{
+    const test::Object obj(10);
+    const auto& add = type<test::Object>()->function("operator+");
+    for (size_t j = 0; j < 2; ++j) add.call<test::Object>(obj, 1);
+
+    CountAllocs allocs;
+    for (size_t j = 0; j < 100; ++j)
+        BOOST_CHECK_EQUAL(add.call<test::Object>(obj, 1).value, 11);
+
+    BOOST_CHECK_EQUAL(allocs.count(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(callInto)
+{
+    test::Object obj(10);
+    Value value(obj);
+    int i = 1;
+
+    const Type* tObject = type<test::Object>();
+    const auto& add = tObject->function("operator+")[0];
+
+    std::aligned_storage<sizeof(test::Object)>::type storage;
+    auto& result = *reinterpret_cast<test::Object*>(&storage);
+
+    CountAllocs allocs;
+    for (size_t j = 0; j < 100; ++j) {
+        add.callInto(&storage, tObject, value, i);
+        BOOST_CHECK_EQUAL(result.value, 11);
+        result.~Object();
+    }
+
+    BOOST_CHECK_EQUAL(allocs.count(), 0u);
+}
+
+// The constructed object has to live somewhere so the only allocation we
+// allow is its storage.
+BOOST_AUTO_TEST_CASE(construct)
+{
+    int i = 10;
+    const Type* tObject = type<test::Object>();
+    for (size_t j = 0; j < 2; ++j) tObject->construct(i);
+
+    CountAllocs allocs;
+    for (size_t j = 0; j < 100; ++j) tObject->construct(i);
+
+    BOOST_CHECK_EQUAL(allocs.count(), 100u);
+}
+
+// Small trivially copyable objects are stored inline and are copied and moved
+// along with the Value while boxed objects are shared by their copies.
+BOOST_AUTO_TEST_CASE(storage)
+{
+    Value boxed = Value(test::Object(10));
+
+    CountAllocs allocs;
+    for (size_t j = 0; j < 100; ++j) {
+        Value value(static_cast<int>(j));
+        BOOST_CHECK_EQUAL(value.get<int>(), int(j));
+        BOOST_CHECK_EQUAL(value.ref().get<int>(), int(j));
+
+        Value copy(value);
+        BOOST_CHECK(copy.isInline());
+        BOOST_CHECK_EQUAL(copy.get<int>(), int(j));
+
+        Value moved(std::move(copy));
+        BOOST_CHECK(moved.isInline());
+        BOOST_CHECK_EQUAL(moved.get<int>(), int(j));
+
+        BOOST_CHECK(value.isInline());
+
+        Value shared(boxed);
+        BOOST_CHECK_EQUAL(shared.value(), boxed.value());
+    }
+
+    BOOST_CHECK_EQUAL(allocs.count(), 0u);
+}
+
+// Boxes are taken out of the installed arena which only needs to go back to
+// the system when it runs out of space.
+BOOST_AUTO_TEST_CASE(arena)
+{
+    int i = 10;
+    const Type* tObject = type<test::Object>();
+
+    Arena arena;
+    arena.allocate(1);
+
+    {
+        ArenaScope scope(arena);
+        BOOST_CHECK_EQUAL(ArenaScope::current(), &arena);
+
+        CountAllocs allocs;
+        for (size_t j = 0; j < 100; ++j) {
+            Value value = tObject->construct(i);
+            BOOST_CHECK_EQUAL(value.get<test::Object>().value, 10);
+        }
+
+        BOOST_CHECK_EQUAL(allocs.count(), 0u);
+        BOOST_CHECK_GT(arena.used(), 100 * sizeof(test::Object));
+    }
+
+    BOOST_CHECK(!ArenaScope::current());
+
+    size_t reserved = arena.reserved();
+    arena.reset();
+    BOOST_CHECK_EQUAL(arena.used(), 0u);
+    BOOST_CHECK_EQUAL(arena.reserved(), reserved);
+
+    CountAllocs allocs;
+    tObject->construct(i);
+    BOOST_CHECK_EQUAL(allocs.count(), 1u);
+}
+
+// Types loaded lazily within an arena scope belong to the registry so their
+// values must not be reclaimed along with the arena.
+BOOST_AUTO_TEST_CASE(arena_loader)
+{
+    Registry::add("alloc_arena_loader", [] (Type* type) {
+                type->addTrait("name", std::string("loaded"));
+            });
+
+    Arena arena;
+    {
+        ArenaScope scope(arena);
+        const Type* type = Registry::get("alloc_arena_loader");
+        BOOST_CHECK_EQUAL(type->getValue<std::string>("name"), "loaded");
+    }
+    BOOST_CHECK_EQUAL(arena.used(), 0u);
+
+    // Scribble over the reclaimed memory to catch anything still using it.
+    arena.reset();
+    size_t size = arena.reserved() ? arena.reserved() / 2 : 1024;
+    std::memset(arena.allocate(size), 0xFF, size);
+
+    const Type* type = Registry::get("alloc_arena_loader");
+    BOOST_CHECK_EQUAL(type->getValue<std::string>("name"), "loaded");
+}
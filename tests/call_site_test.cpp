@@ -0,0 +1,79 @@
+/* call_site_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for call_site.h
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include "tests.h"
+#include "reflect.h"
+#include "test_types.h"
+#include "types/primitives.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* BASICS                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(basics)
+{
+    CallSite<int&(Value&)> ref("ref");
+    BOOST_CHECK_EQUAL(ref.cached(), 0u);
+
+    test::Object obj(10);
+    Value value(obj);
+
+    BOOST_CHECK_EQUAL(&ref(value), &obj.value);
+    BOOST_CHECK_EQUAL(ref.cached(), 1u);
+
+    ref(value) = 20;
+    BOOST_CHECK_EQUAL(obj.value, 20);
+    BOOST_CHECK_EQUAL(ref.cached(), 1u);
+}
+
+
+/******************************************************************************/
+/* POLYMORPHIC                                                                */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(polymorphic)
+{
+    CallSite<Value(Value&, int)> add("operator+");
+
+    test::Object obj(1);
+    Value vObj(obj);
+
+    int i = 2;
+    Value vInt(i);
+
+    for (size_t round = 0; round < 3; ++round) {
+        BOOST_CHECK_EQUAL(add(vObj, 10).get<test::Object>().value, 11);
+        BOOST_CHECK_EQUAL(add(vInt, 10).get<int>(), 12);
+    }
+
+    BOOST_CHECK_EQUAL(add.cached(), 2u);
+}
+
+
+/******************************************************************************/
+/* OVERLOADS                                                                  */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(overloads)
+{
+    const auto& fns = type<test::Object>()->function("operator+=");
+    CallSite<void(test::Object&, int)> addAssign(fns);
+
+    test::Object obj(0);
+    for (size_t i = 0; i < 10; ++i) addAssign(obj, 1);
+
+    BOOST_CHECK_EQUAL(obj.value, 10);
+    BOOST_CHECK_EQUAL(addAssign.cached(), 1u);
+}
@@ -185,3 +185,69 @@ BOOST_AUTO_TEST_CASE(baz)
     BOOST_CHECK_EQUAL(vBazParent.field<int>("shadowed"), bazParent.shadowed);
     BOOST_CHECK_NE(vBaz.field<int>("shadowed"), bazParent.shadowed);
 }
+
+
+/******************************************************************************/
+/* FIELD REF                                                                  */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(fieldRef)
+{
+    const Type* tFoo = type("Foo");
+    const Type* tBar = type("Bar");
+    const Type* tBaz = type("Baz");
+
+    FieldRef field(tFoo, "field");
+    FieldRef constField(tFoo, "constField");
+    BOOST_CHECK_EQUAL(field.owner(), tFoo);
+    BOOST_CHECK_EQUAL(field.type(), type<int>());
+    BOOST_CHECK_EQUAL(field.offset(), tFoo->field("field").offset());
+    BOOST_CHECK(!field.isConst());
+    BOOST_CHECK( constField.isConst());
+
+    Foo foo;
+    field.set(foo, 10);
+    BOOST_CHECK_EQUAL(foo.field, 10);
+    BOOST_CHECK_EQUAL(field.get<int>(foo), 10);
+    BOOST_CHECK_EQUAL(&field.get<int>(foo), &foo.field);
+    BOOST_CHECK_EQUAL(field.ref(ValueRef(foo)).value(), &foo.field);
+
+    Value vFoo(foo);
+    field.set(vFoo, 20);
+    BOOST_CHECK_EQUAL(field.get<int>(vFoo), 20);
+    BOOST_CHECK_EQUAL(field.get<int>(ValueRef(foo)), 20);
+
+    // Not the exact type of the field so it goes through operator=.
+    field.set(foo, Value(30));
+    BOOST_CHECK_EQUAL(foo.field, 30);
+
+    CHECK_ERROR(field.get<Foo>(foo));
+    CHECK_ERROR(constField.set(foo, 1));
+    CHECK_ERROR(field.set(static_cast<const Foo&>(foo), 1));
+
+    Bar bar;
+    CHECK_ERROR(field.get<int>(bar));
+
+    FieldRef shadowed(tBar, "shadowed");
+    FieldRef bazShadowed(tBaz, "shadowed");
+
+    Baz baz;
+    shadowed.set(baz, 1);
+    bazShadowed.set(baz, 2);
+    BOOST_CHECK_EQUAL(static_cast<Bar&>(baz).shadowed, 1);
+    BOOST_CHECK_EQUAL(baz.shadowed, 2);
+
+    Foo foos[4];
+    int values[4] = { 1, 2, 3, 4 };
+    field.scatter(foos, 4, values);
+    for (size_t i = 0; i < 4; ++i) BOOST_CHECK_EQUAL(foos[i].field, values[i]);
+
+    int result[4] = {};
+    field.gather(foos, 4, result);
+    for (size_t i = 0; i < 4; ++i) BOOST_CHECK_EQUAL(result[i], values[i]);
+
+    CHECK_ERROR(constField.scatter(foos, 4, values));
+
+    short shorts[4] = {};
+    CHECK_ERROR(field.scatter(foos, 4, shorts));
+}
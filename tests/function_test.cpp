@@ -652,3 +652,126 @@ BOOST_AUTO_TEST_CASE(converters_call)
     BOOST_CHECK_EQUAL(rrefFn.call<int>(convConstLRef), doRRef(convConstLRef));
     BOOST_CHECK_EQUAL(rrefFn.call<int>(Conv(10)), doRRef(Conv(10)));
 }
+
+
+/******************************************************************************/
+/* OVERLOADS                                                                  */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(overloads)
+{
+    Overloads fns;
+    fns.add(Function("f", [] (int i) { return i; }));
+
+    int i = 10;
+    const Function* fn = &fns.resolve<int>(i);
+    BOOST_CHECK_EQUAL(fn, &fns[0]);
+    BOOST_CHECK_EQUAL(&fns.resolve<int>(i), fn);
+    BOOST_CHECK_EQUAL(fns.call<int>(i), 10);
+
+    // Adding overloads can move the existing ones so the memoized result
+    // must not survive.
+    fns.add(Function("f", [] (unsigned) { return 1; }));
+    fns.add(Function("f", [] (double) { return 2; }));
+    fns.add(Function("f", [] (bool) { return 3; }));
+    fns.add(Function("f", [] (test::Object) { return 4; }));
+
+    BOOST_CHECK_EQUAL(&fns.resolve<int>(i), &fns[0]);
+    BOOST_CHECK_EQUAL(fns.call<int>(i), 10);
+    BOOST_CHECK_EQUAL(fns.call<int>(test::Object(1)), 4);
+    BOOST_CHECK_EQUAL(fns.call<int>(test::Object(1)), 4);
+
+    CHECK_ERROR(fns.call<int>(test::Parent()));
+}
+
+// Copies resolve to their own functions and not the memoized ones of the
+// original which they can outlive.
+BOOST_AUTO_TEST_CASE(overloads_copy)
+{
+    int i = 10;
+    std::unique_ptr<Overloads> fns(new Overloads);
+    fns->add(Function("f", [] (int i) { return i; }));
+    fns->add(Function("f", [] (test::Object) { return 4; }));
+    BOOST_CHECK_EQUAL(&fns->resolve<int>(i), &(*fns)[0]);
+
+    Overloads copy(*fns);
+    BOOST_CHECK_EQUAL(copy.size(), fns->size());
+    fns.reset();
+
+    BOOST_CHECK_EQUAL(&copy.resolve<int>(i), &copy[0]);
+    BOOST_CHECK_EQUAL(copy.call<int>(i), 10);
+    BOOST_CHECK_EQUAL(copy.call<int>(test::Object(1)), 4);
+
+    Overloads assigned;
+    assigned.add(Function("g", [] (test::Object) { return 2; }));
+    BOOST_CHECK_EQUAL(assigned.call<int>(test::Object(1)), 2);
+
+    assigned = copy;
+    BOOST_CHECK_EQUAL(assigned.size(), 2u);
+    BOOST_CHECK_EQUAL(&assigned.resolve<int>(i), &assigned[0]);
+    BOOST_CHECK_EQUAL(assigned.call<int>(i), 10);
+    BOOST_CHECK_EQUAL(assigned.call<int>(test::Object(1)), 4);
+}
+
+
+/******************************************************************************/
+/* INVOKE                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(invoke)
+{
+    test::Object obj(10);
+    int i = 2;
+
+    std::vector<Value> args;
+    args.emplace_back(obj);
+    args.emplace_back(i);
+
+    Value result;
+    const auto& fns = type<test::Object>()->function("operator+=");
+
+    fns.invoke(args.data(), args.size(), result);
+    BOOST_CHECK_EQUAL(obj.value, 12);
+    BOOST_CHECK_EQUAL(&result.get<test::Object>(), &obj);
+
+    fns[0].invoke(args.data(), args.size(), result);
+    BOOST_CHECK_EQUAL(obj.value, 14);
+
+    const auto& add = type<test::Object>()->function("operator+");
+    add.invoke(args.data(), args.size(), result);
+    BOOST_CHECK_EQUAL(result.get<test::Object>().value, 16);
+    BOOST_CHECK_EQUAL(obj.value, 14);
+
+    CHECK_ERROR(fns[0].invoke(args.data(), 1, result));
+    CHECK_ERROR(fns.invoke(args.data() + 1, 1, result));
+}
+
+
+/******************************************************************************/
+/* CALL INTO                                                                  */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(callInto)
+{
+    typedef std::aligned_storage<sizeof(test::Object)>::type Storage;
+
+    test::Object obj(10);
+    const Type* tObject = type<test::Object>();
+    const auto& fns = tObject->function("operator+");
+
+    Storage storage;
+    fns[0].callInto(&storage, tObject, obj, 5);
+
+    auto& result = *reinterpret_cast<test::Object*>(&storage);
+    BOOST_CHECK_EQUAL(result.value, 15);
+    result.~Object();
+
+    // References are copied into the storage.
+    const auto& ref = tObject->function("ref");
+    int value;
+    ref[0].callInto(&value, type<int>(), obj);
+    BOOST_CHECK_EQUAL(value, 10);
+
+    CHECK_ERROR(fns[0].callInto(&storage, type<int>(), obj, 5));
+    CHECK_ERROR(fns[0].callInto(&storage, tObject, obj));
+}
@@ -0,0 +1,68 @@
+/* call_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Benchmark for the various ways of calling a reflected function.
+*/
+
+#include "perf.h"
+#include "dsl/all.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* TYPES                                                                      */
+/******************************************************************************/
+
+struct PerfGetter
+{
+    PerfGetter() : value(0) {}
+    int get() const { return value; }
+    int value;
+};
+
+reflectType(PerfGetter)
+{
+    reflectPlumbing();
+    reflectFn(get);
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    double seconds = perf::duration(argc, argv);
+
+    const PerfGetter obj;
+    const Function& fn = type<PerfGetter>()->function("get")[0];
+
+    Value value(obj);
+
+    size_t ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                int result = obj.get();
+                asm volatile ("" : : "r" (result));
+            });
+    perf::report("direct", 1, ops, seconds);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                int result = fn.call<int>(obj);
+                asm volatile ("" : : "r" (result));
+            });
+    perf::report("function.typed", 1, ops, seconds);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                int result = fn.call<int>(value);
+                asm volatile ("" : : "r" (result));
+            });
+    perf::report("function.value", 1, ops, seconds);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                int result = value.call<int>("get");
+                asm volatile ("" : : "r" (result));
+            });
+    perf::report("value.call", 1, ops, seconds);
+}
@@ -0,0 +1,233 @@
+/* json_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Benchmark for the json reader and parser.
+
+   The tokenizer throughput is reported for every scan mode supported by the
+   CPU. The path to an additional json file to scan can be passed as the
+   second argument and defaults to tests/data/cubes.json which is skipped if
+   it can't be found from the current directory.
+*/
+
+#include "perf.h"
+#include "utils/json.h"
+
+#include <sstream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+std::string makeDocument(size_t items)
+{
+    std::stringstream ss;
+    ss << "[\n";
+
+    for (size_t i = 0; i < items; ++i) {
+        if (i) ss << ",\n";
+        ss << "  { \"id\": " << i
+           << ", \"name\": \"item number " << i << "\""
+           << ", \"ratio\": " << (i * 0.731)
+           << ", \"tags\": [ \"abc\", \"defghi\", \"jkl\" ]"
+           << ", \"enabled\": " << (i % 2 ? "true" : "false")
+           << ", \"parent\": null }";
+    }
+
+    ss << "\n]\n";
+    return ss.str();
+}
+
+// Document made mostly of long strings spread over indented lines.
+std::string makeText(size_t items)
+{
+    std::stringstream ss;
+    ss << "[\n";
+
+    for (size_t i = 0; i < items; ++i) {
+        if (i) ss << ",\n";
+        ss << "                {\n"
+           << "                    \"title\": \"entry " << i
+           << " of a rather long list of entries\",\n"
+           << "                    \"body\": \""
+           << std::string(64 + i % 64, 'x') << "\\n"
+           << std::string(32, 'y') << "\"\n"
+           << "                }";
+    }
+
+    ss << "\n]\n";
+    return ss.str();
+}
+
+// Array of mixed integers and floats of various magnitudes.
+std::string makeNumbers(size_t items)
+{
+    std::stringstream ss;
+    ss.precision(17);
+    ss << "[";
+
+    uint64_t x = 1;
+    for (size_t i = 0; i < items; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        if (i) ss << ",";
+        if (i % 2) ss << int64_t(x >> (x % 64));
+        else ss << double(x >> 11) * std::pow(10.0, int(x % 40) - 30);
+    }
+
+    ss << "]";
+    return ss.str();
+}
+
+size_t tokenize(json::Reader& reader)
+{
+    size_t tokens = 0;
+    while (reader.nextToken().type() != json::Token::EOS) tokens++;
+    if (reader.error()) reflectError("%s", reader.error().what());
+    return tokens;
+}
+
+void report(const char* name, size_t ops, double seconds, size_t bytes)
+{
+    perf::report(name, 1, ops, seconds);
+    fprintf(stderr, "%-20s %.0f MB/s\n", "", (ops * bytes) / seconds / 1e6);
+}
+
+// Tokenizes the input repeatedly for every supported scan mode until the
+// duration elapses.
+void throughput(
+        const std::string& name, const char* data, size_t size, double seconds)
+{
+    typedef json::ScanMode Mode;
+    Mode best = json::detectScanMode();
+
+    for (Mode mode : { Mode::Scalar, Mode::SSE2, Mode::AVX2 }) {
+        if (!json::setScanMode(mode)) continue;
+
+        size_t ops = 0;
+        double start = perf::now();
+        double elapsed = 0;
+
+        do {
+            json::Reader reader(data, size);
+            tokenize(reader);
+            ops++;
+        } while ((elapsed = perf::now() - start) < seconds);
+
+        std::string label = "scan(" + name + ", " + print(mode) + ")";
+        fprintf(stderr, "%-30s %8.0f MB/s\n",
+                label.c_str(), (ops * size) / elapsed / 1e6);
+    }
+
+    json::setScanMode(best);
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    double seconds = perf::duration(argc, argv);
+
+    const std::string doc = makeDocument(20);
+
+    size_t ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                std::istringstream stream(doc);
+                json::Reader reader(stream);
+                tokenize(reader);
+            });
+    report("tokens(stream)", ops, seconds, doc.size());
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                json::Reader reader(doc);
+                tokenize(reader);
+            });
+    report("tokens(buffer)", ops, seconds, doc.size());
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                Value value;
+                json::Error err = json::parse(doc, value);
+                if (err) reflectError("%s", err.what());
+            });
+    report("parse(Value)", ops, seconds, doc.size());
+
+    const std::string numbers = makeNumbers(100);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                json::Reader reader(numbers);
+                auto onItem = [&] (size_t) { json::parseFloat(reader); };
+                json::parseArray(reader, onItem);
+            });
+    report("numbers(tokens)", ops, seconds, numbers.size());
+
+    // Reference conversion of the same numbers with strtod.
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                char* end;
+                const char* it = numbers.c_str() + 1;
+                while (*it) {
+                    std::strtod(it, &end);
+                    it = end + 1; // skips the separator.
+                }
+            });
+    report("numbers(strtod)", ops, seconds, numbers.size());
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t) {
+                Value value;
+                json::Error err = json::parse(numbers, value);
+                if (err) reflectError("%s", err.what());
+            });
+    report("numbers(Value)", ops, seconds, numbers.size());
+
+    std::vector<double> floats;
+    std::vector<int64_t> ints;
+    for (uint64_t x = 1; floats.size() < 1024;) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        floats.push_back(double(x >> 11) * std::pow(10.0, int(x % 40) - 30));
+        ints.push_back(int64_t(x >> (x % 64)));
+    }
+
+    std::ostringstream out;
+    json::Writer writer(out);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                if (!(i % 1024)) out.str("");
+                json::formatFloat(writer, floats[i % 1024]);
+            });
+    perf::report("formatFloat", 1, ops, seconds);
+
+    // Reference formatting of the same floats with the precision required
+    // to round-trip.
+    ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                char buffer[32];
+                if (!(i % 1024)) out.str("");
+
+                double value = floats[i % 1024];
+                out.write(buffer, snprintf(buffer, 32, "%.17g", value));
+            });
+    perf::report("snprintf(%.17g)", 1, ops, seconds);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                if (!(i % 1024)) out.str("");
+                json::formatInt(writer, ints[i % 1024]);
+            });
+    perf::report("formatInt", 1, ops, seconds);
+
+    const std::string records = makeDocument(20000);
+    throughput("records", records.data(), records.size(), seconds);
+
+    const std::string text = makeText(20000);
+    throughput("text", text.data(), text.size(), seconds);
+
+    json::MappedFile file(argc > 2 ? argv[2] : "tests/data/cubes.json");
+    if (!file.error())
+        throughput("file", file.data(), file.size(), seconds);
+    else fprintf(stderr, "scan(file): skipped: %s\n", file.error().what());
+}
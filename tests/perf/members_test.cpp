@@ -0,0 +1,113 @@
+/* members_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Benchmark for member lookups by name on finalized types and for field
+   accesses through precomputed FieldRef handles.
+*/
+
+#include "perf.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+std::vector<std::string> names(size_t members)
+{
+    std::vector<std::string> result;
+    for (size_t i = 0; i < members; ++i)
+        result.push_back("member_" + std::to_string(i));
+    return result;
+}
+
+const Type* makeType(const std::vector<std::string>& fields)
+{
+    std::string id = "PerfMembers_" + std::to_string(fields.size());
+
+    Registry::add(id, [=] (Type* type) {
+                for (const auto& field : fields)
+                    type->addField<int>(field, 0);
+            });
+
+    return Registry::get(id);
+}
+
+
+/******************************************************************************/
+/* BENCH                                                                      */
+/******************************************************************************/
+
+void bench(size_t members, double seconds)
+{
+    auto fields = names(members);
+    const Type* type = makeType(fields);
+
+    std::unordered_map<std::string, const Field*> baseline;
+    std::vector<Symbol> symbols;
+    for (const auto& field : fields) {
+        baseline[field] = &type->field(field);
+        symbols.emplace_back(field);
+    }
+
+    char name[64];
+
+    size_t ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                const Field* field = baseline.find(fields[i % members])->second;
+                asm volatile ("" : : "r" (field));
+            });
+    snprintf(name, sizeof(name), "unordered_map/%zu", members);
+    perf::report(name, 1, ops, seconds);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                const Field* field = &type->field(fields[i % members]);
+                asm volatile ("" : : "r" (field));
+            });
+    snprintf(name, sizeof(name), "field(string)/%zu", members);
+    perf::report(name, 1, ops, seconds);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                const Field* field = &type->field(symbols[i % members]);
+                asm volatile ("" : : "r" (field));
+            });
+    snprintf(name, sizeof(name), "field(symbol)/%zu", members);
+    perf::report(name, 1, ops, seconds);
+
+    // All the fields live at offset 0 so a single int is enough storage.
+    int storage = 0;
+    ValueRef obj(Argument(type, RefType::LValue, false), &storage);
+    Value value = obj.toValue();
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                int field = value.field<int>(fields[i % members]);
+                asm volatile ("" : : "r" (field));
+            });
+    snprintf(name, sizeof(name), "value.field/%zu", members);
+    perf::report(name, 1, ops, seconds);
+
+    std::vector<FieldRef> refs;
+    for (const auto& field : fields) refs.emplace_back(type, field);
+
+    ops = perf::run(1, seconds, [&] (size_t, size_t i) {
+                int field = refs[i % members].get<int>(obj);
+                asm volatile ("" : : "r" (field));
+            });
+    snprintf(name, sizeof(name), "fieldRef.get/%zu", members);
+    perf::report(name, 1, ops, seconds);
+}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    double seconds = perf::duration(argc, argv);
+
+    bench(5, seconds);
+    bench(50, seconds);
+    bench(500, seconds);
+}
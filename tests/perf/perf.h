@@ -0,0 +1,83 @@
+/* perf.h                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Runtime performance tests utilities.
+
+   Benchmarks are registered as regular tests so they run for a short duration
+   by default. The duration in seconds can be overridden by passing it as the
+   first argument of the test executable.
+*/
+
+#pragma once
+
+#include "reflect.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+namespace perf {
+
+/******************************************************************************/
+/* TIME                                                                       */
+/******************************************************************************/
+
+inline double now()
+{
+    typedef std::chrono::duration<double> Seconds;
+    auto ts = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<Seconds>(ts).count();
+}
+
+inline double duration(int argc, char** argv, double def = 0.1)
+{
+    return argc > 1 ? std::atof(argv[1]) : def;
+}
+
+
+/******************************************************************************/
+/* RUN                                                                        */
+/******************************************************************************/
+
+// Calls fn(thread, iteration) repeatedly on the given number of threads until
+// the duration elapses and returns the total number of calls made.
+template<typename Fn>
+size_t run(size_t threads, double seconds, Fn&& fn)
+{
+    enum { Batch = 1024 };
+
+    std::atomic<size_t> ops(0);
+    std::atomic<size_t> ready(0);
+    std::vector<std::thread> workers;
+
+    for (size_t thread = 0; thread < threads; ++thread) {
+        workers.emplace_back([&, thread] {
+                    ready++;
+                    while (ready != threads) std::this_thread::yield();
+
+                    size_t i = 0;
+                    double end = now() + seconds;
+
+                    do {
+                        for (size_t j = 0; j < Batch; ++j, ++i) fn(thread, i);
+                    } while (now() < end);
+
+                    ops += i;
+                });
+    }
+
+    for (auto& worker : workers) worker.join();
+    return ops;
+}
+
+inline void report(const char* name, size_t threads, size_t ops, double seconds)
+{
+    fprintf(stderr, "%-20s threads=%-3zu %12.0f ops/sec %8.2f ns/op\n",
+            name, threads, ops / seconds, (seconds * threads * 1e9) / ops);
+}
+
+} // namespace perf
@@ -0,0 +1,57 @@
+/* registry_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Multi-threaded stress benchmark for registry lookups.
+*/
+
+#include "perf.h"
+#include "dsl/type.h"
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* TYPES                                                                      */
+/******************************************************************************/
+
+struct PerfKey {};
+reflectType(PerfKey) {}
+
+
+/******************************************************************************/
+/* MAIN                                                                       */
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    enum { Types = 1000 };
+    double seconds = perf::duration(argc, argv);
+
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < Types; ++i) {
+        ids.push_back("PerfThing_" + std::to_string(i));
+        Registry::add(ids.back(), [] (Type*) {});
+    }
+
+    // First lookups are racing against the loaders.
+    perf::run(4, 0, [&] (size_t, size_t i) {
+                (void) Registry::get(ids[i % Types]);
+            });
+
+    size_t maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        size_t ops = perf::run(threads, seconds, [&] (size_t thread, size_t i) {
+                    (void) Registry::get(ids[(i * 7 + thread) % Types]);
+                });
+        perf::report("registry.get", threads, ops, seconds);
+    }
+
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        size_t ops = perf::run(threads, seconds, [&] (size_t, size_t) {
+                    const Type* type = reflect::type<PerfKey>();
+                    asm volatile ("" : : "r" (type));
+                });
+        perf::report("type<T>", threads, ops, seconds);
+    }
+}
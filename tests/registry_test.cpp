@@ -0,0 +1,328 @@
+/* registry_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for the type registry.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include "reflect.h"
+#include "dsl/type.h"
+#include "tests.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+#include <vector>
+#include <set>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* UTILS                                                                      */
+/******************************************************************************/
+
+template<typename Fn>
+void parallel(size_t threads, Fn&& fn)
+{
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threads; ++i)
+        workers.emplace_back([&, i] { fn(i); });
+
+    for (auto& worker : workers) worker.join();
+}
+
+
+/******************************************************************************/
+/* BASICS                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(basics)
+{
+    size_t loads = 0;
+    Registry::add("registry_basics", [&] (Type*) { loads++; });
+
+    const Type* type = Registry::get("registry_basics");
+    BOOST_CHECK_EQUAL(type->id(), "registry_basics");
+    BOOST_CHECK_EQUAL(Registry::get("registry_basics"), type);
+    BOOST_CHECK_EQUAL(loads, 1u);
+
+    // Loaders for an existing type are ignored.
+    Registry::add("registry_basics", [&] (Type*) { loads++; });
+    BOOST_CHECK_EQUAL(Registry::get("registry_basics"), type);
+    BOOST_CHECK_EQUAL(loads, 1u);
+
+    CHECK_ERROR(Registry::get("registry_missing"));
+}
+
+BOOST_AUTO_TEST_CASE(alias)
+{
+    // Aliases can be declared before the type they point to.
+    Registry::alias("registry_alias", "registry_alias_a");
+    Registry::add("registry_alias", [] (Type*) {});
+
+    BOOST_CHECK_EQUAL(
+            Registry::get("registry_alias_a"),
+            Registry::get("registry_alias"));
+
+    CHECK_ERROR(Registry::alias("registry_basics", "registry_alias_a"));
+}
+
+BOOST_AUTO_TEST_CASE(recursive)
+{
+    const Type* self = nullptr;
+    const Type* other = nullptr;
+
+    Registry::add("registry_rec_a", [&] (Type* type) {
+                self = Registry::get("registry_rec_a");
+                BOOST_CHECK_EQUAL(self, type);
+                other = Registry::get("registry_rec_b");
+            });
+
+    Registry::add("registry_rec_b", [&] (Type*) {
+                BOOST_CHECK_EQUAL(Registry::get("registry_rec_a"), self);
+            });
+
+    BOOST_CHECK_EQUAL(Registry::get("registry_rec_a"), self);
+    BOOST_CHECK_EQUAL(Registry::get("registry_rec_b"), other);
+}
+
+BOOST_AUTO_TEST_CASE(loader_retry)
+{
+    size_t loads = 0;
+    Registry::add("registry_retry", [&] (Type* type) {
+                if (!loads++) throw std::runtime_error("first load fails");
+                type->addTrait("loaded");
+            });
+
+    BOOST_CHECK_THROW(Registry::get("registry_retry"), std::runtime_error);
+
+    const Type* type = Registry::get("registry_retry");
+    BOOST_CHECK(type->is("loaded"));
+    BOOST_CHECK_EQUAL(loads, 2u);
+}
+
+
+/******************************************************************************/
+/* TYPED                                                                      */
+/******************************************************************************/
+
+struct Recursive {};
+
+const Type* recursiveType = nullptr;
+
+reflectType(Recursive)
+{
+    recursiveType = type<Recursive>();
+    BOOST_CHECK_EQUAL(recursiveType, type_);
+}
+
+BOOST_AUTO_TEST_CASE(typed)
+{
+    const Type* type = reflect::type<Recursive>();
+    BOOST_CHECK_EQUAL(type, recursiveType);
+    BOOST_CHECK_EQUAL(type, Registry::get("Recursive"));
+    BOOST_CHECK_EQUAL(type, TypeCache<Recursive>::type.load());
+    BOOST_CHECK_EQUAL(reflect::type<const Recursive&>(), type);
+}
+
+
+/******************************************************************************/
+/* RECORDS                                                                    */
+/******************************************************************************/
+
+struct RecordOnly {};
+reflectType(RecordOnly) { reflectTypeTrait(recordOnly); }
+
+BOOST_AUTO_TEST_CASE(records)
+{
+    // Never looked up through its type so the registry can only find it through
+    // its record.
+    const Type* type = Registry::get("RecordOnly");
+    BOOST_CHECK_EQUAL(type->id(), "RecordOnly");
+    BOOST_CHECK(type->is("recordOnly"));
+    BOOST_CHECK(Registry::globalScope()->hasType("RecordOnly"));
+}
+
+
+/******************************************************************************/
+/* MEMORY                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(memory)
+{
+    MemoryReport before = Registry::memoryReport();
+
+    const Type* type = Registry::get("test::Parent");
+    BOOST_CHECK(type->hasField("value"));
+
+    MemoryReport after = Registry::memoryReport();
+    BOOST_CHECK_GT(after.types, before.types);
+    BOOST_CHECK_GT(after.functions, before.functions);
+    BOOST_CHECK_GT(after.fields, before.fields);
+    BOOST_CHECK_GT(after.traits, 0u);
+    BOOST_CHECK_GT(after.scopes, 0u);
+    BOOST_CHECK_GE(after.reserved, after.total());
+}
+
+BOOST_AUTO_TEST_CASE(memory_transient)
+{
+    const Type* type = Registry::get("test::Parent");
+    MemoryReport before = Registry::memoryReport();
+
+    // Copies made outside of a loader belong to the user and must not be
+    // allocated from the registry's arena.
+    Field field = type->field("value");
+    field.addTrait("transient");
+    Overloads overloads;
+    overloads.add(Function("transient", [] (int i) { return i; }));
+    Overloads copy = type->function(type->id());
+
+    MemoryReport after = Registry::memoryReport();
+    BOOST_CHECK_EQUAL(after.fields, before.fields);
+    BOOST_CHECK_EQUAL(after.functions, before.functions);
+    BOOST_CHECK_EQUAL(after.traits, before.traits);
+
+    BOOST_CHECK(field.is("transient"));
+    BOOST_CHECK(!type->field("value").is("transient"));
+    BOOST_CHECK_EQUAL(overloads.call<int>(1), 1);
+    BOOST_CHECK_EQUAL(copy.size(), type->function(type->id()).size());
+}
+
+
+/******************************************************************************/
+/* CONCURRENCY                                                                */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(concurrent_load)
+{
+    enum { Threads = 8, Types = 100 };
+
+    std::atomic<size_t> loads(0);
+    std::vector<std::string> ids;
+
+    for (size_t i = 0; i < Types; ++i) {
+        ids.push_back("registry_concurrent_" + std::to_string(i));
+        Registry::add(ids.back(), [&] (Type*) {
+                    loads++;
+                    std::this_thread::yield();
+                });
+    }
+
+    std::vector< std::vector<const Type*> > seen(Threads);
+    std::atomic<size_t> ready(0);
+
+    parallel(Threads, [&] (size_t thread) {
+                ready++;
+                while (ready != Threads) std::this_thread::yield();
+
+                for (const auto& id : ids)
+                    seen[thread].push_back(Registry::get(id));
+            });
+
+    BOOST_CHECK_EQUAL(loads.load(), size_t(Types));
+    for (size_t thread = 1; thread < Threads; ++thread)
+        BOOST_CHECK(seen[thread] == seen[0]);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_partial)
+{
+    std::atomic<bool> started(false);
+
+    Registry::add("registry_partial_slow", [&] (Type* type) {
+                started = true;
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                type->addTrait("loaded");
+            });
+
+    // Only tallied as Boost.Test assertions are not thread-safe.
+    std::atomic<bool> loaded(false);
+
+    Registry::add("registry_partial_user", [&] (Type*) {
+                while (!started) std::this_thread::yield();
+
+                // Another thread owns the load so we must wait for it to finish
+                // even though we're running a loader ourselves.
+                loaded = Registry::get("registry_partial_slow")->is("loaded");
+            });
+
+    parallel(2, [&] (size_t thread) {
+                if (!thread) Registry::get("registry_partial_slow");
+                else Registry::get("registry_partial_user");
+            });
+
+    BOOST_CHECK(loaded);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_add)
+{
+    enum { Threads = 4, Types = 1000 };
+
+    // Boost.Test assertions are not thread-safe so we tally up the failures.
+    std::atomic<size_t> errors(0);
+
+    parallel(Threads, [&] (size_t thread) {
+                for (size_t i = 0; i < Types; ++i) {
+                    std::string id = "registry_add_";
+                    id += std::to_string(thread) + "_" + std::to_string(i);
+
+                    Registry::add(id, [] (Type*) {});
+                    if (Registry::get(id)->id() != id) errors++;
+                }
+            });
+
+    BOOST_CHECK_EQUAL(errors.load(), 0u);
+}
+
+
+/******************************************************************************/
+/* PRELOAD                                                                    */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(preload)
+{
+    enum { Types = 100 };
+
+    std::atomic<size_t> loads(0);
+
+    for (size_t i = 0; i < Types; ++i) {
+        std::string id = "registry_preload_" + std::to_string(i);
+
+        // Every type depends on the next one to exercise dependencies between
+        // loaders running on different threads.
+        std::string dep = "registry_preload_" + std::to_string((i + 1) % Types);
+
+        Registry::add(id, [&, dep] (Type*) {
+                    loads++;
+                    Registry::get(dep);
+                });
+    }
+
+    Registry::add("registry_unrelated", [&] (Type*) { loads++; });
+
+    auto stats = Registry::preload("registry_preload_", 4);
+    BOOST_CHECK_EQUAL(loads.load(), size_t(Types));
+    BOOST_CHECK_EQUAL(stats.size(), size_t(Types));
+
+    // One entry per type whether it was loaded by preload or as a dependency.
+    std::set<std::string> ids;
+    for (const auto& stat : stats) {
+        BOOST_CHECK_EQUAL(stat.id.compare(0, 17, "registry_preload_"), 0);
+        BOOST_CHECK_GE(stat.elapsed, 0.0);
+        ids.insert(stat.id);
+    }
+    BOOST_CHECK_EQUAL(ids.size(), size_t(Types));
+
+    // Everything was loaded so no loaders should be triggered.
+    for (size_t i = 0; i < Types; ++i)
+        Registry::get("registry_preload_" + std::to_string(i));
+    BOOST_CHECK_EQUAL(loads.load(), size_t(Types));
+
+    BOOST_CHECK(Registry::preload("registry_preload_").empty());
+}
@@ -0,0 +1,75 @@
+/* symbol_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 17 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for interned symbols.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#define REFLECT_USE_EXCEPTIONS 1
+
+#include "reflect.h"
+#include "test_types.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* INTERN                                                                     */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(intern)
+{
+    Symbol a("symbol_test_a");
+    Symbol b(std::string("symbol_test_a"));
+    Symbol c("symbol_test_c");
+
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a != c);
+    BOOST_CHECK_EQUAL(a.str(), "symbol_test_a");
+    BOOST_CHECK_EQUAL(a.hash(), b.hash());
+
+    BOOST_CHECK(Symbol::find("symbol_test_a") == a);
+    BOOST_CHECK(!Symbol::find("symbol_test_never_interned"));
+    BOOST_CHECK(!Symbol());
+    BOOST_CHECK_EQUAL(Symbol().str(), "");
+}
+
+
+/******************************************************************************/
+/* LOOKUPS                                                                    */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(lookups)
+{
+    const Type* type = reflect::type<test::Parent>();
+
+    Symbol shadowed("shadowed");
+    Symbol normalVirtual("normalVirtual");
+    Symbol missing("symbol_test_missing");
+
+    BOOST_CHECK(type->hasField(shadowed));
+    BOOST_CHECK(!type->hasField(missing));
+    BOOST_CHECK_EQUAL(&type->field(shadowed), &type->field("shadowed"));
+
+    BOOST_CHECK(type->hasFunction(normalVirtual));
+    BOOST_CHECK(!type->hasFunction(missing));
+    BOOST_CHECK_EQUAL(
+            &type->function(normalVirtual), &type->function("normalVirtual"));
+
+    test::Parent parent;
+    Value vParent(parent);
+    vParent.field<int&>(shadowed) = 10;
+    BOOST_CHECK_EQUAL(parent.shadowed, 10);
+    vParent.call<void>(normalVirtual);
+
+    const Type* child = reflect::type<test::Child>();
+    BOOST_CHECK(child->hasFunction(normalVirtual));
+    BOOST_CHECK(child->hasField(Symbol("value")));
+
+    BOOST_CHECK(reflect::type<void>()->is(Symbol("primitive")));
+    BOOST_CHECK(!reflect::type<void>()->is(missing));
+}
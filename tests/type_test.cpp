@@ -14,6 +14,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace reflect;
 
 BOOST_AUTO_TEST_CASE(void_)
@@ -195,6 +199,28 @@ BOOST_AUTO_TEST_CASE(parentChild)
     BOOST_CHECK( tChild->isChildOf<test::Parent>());
     BOOST_CHECK( tChild->isChildOf<test::Child>());
     BOOST_CHECK(!tChild->isChildOf<test::Object>());
+
+    BOOST_CHECK(tInterface->isFinalized());
+    BOOST_CHECK(tParent->isFinalized());
+    BOOST_CHECK(tChild->isFinalized());
+
+    // Inherited members resolve to the parent's entries.
+    BOOST_CHECK_EQUAL(&tChild->field("value"), &tParent->field("value"));
+    BOOST_CHECK_NE(&tChild->field("shadowed"), &tParent->field("shadowed"));
+    BOOST_CHECK_EQUAL(
+            &tChild->function("pureVirtual"),
+            &tInterface->function("pureVirtual"));
+
+    // Name lookups go through the frozen tables and agree with symbols.
+    const char* name = "childValue_";
+    BOOST_CHECK( tChild->hasField(name, 10));
+    BOOST_CHECK(!tChild->hasField(name, 11));
+    BOOST_CHECK(!tChild->hasField(name, 5));
+    BOOST_CHECK_EQUAL(
+            &tChild->field(name, 10), &tChild->field(Symbol("childValue")));
+    BOOST_CHECK_EQUAL(
+            &tChild->function("normalVirtual", 13),
+            &tChild->function(Symbol("normalVirtual")));
 }
 
 BOOST_AUTO_TEST_CASE(converter)
@@ -208,4 +234,100 @@ BOOST_AUTO_TEST_CASE(converter)
     BOOST_CHECK( tConvertible->hasConverter<int>());
     BOOST_CHECK( tConvertible->hasConverter<test::Parent>());
     BOOST_CHECK(!tConvertible->hasConverter<test::Convertible>());
+
+    BOOST_CHECK_EQUAL(
+            &tConvertible->converter<int>(),
+            &tConvertible->function("operator int()")[0]);
+}
+
+// Members added to a finalized type show up in its finalized children.
+BOOST_AUTO_TEST_CASE(lateMembers)
+{
+    Type* parent = nullptr;
+    Registry::add("type_late_parent", [&] (Type* type) { parent = type; });
+    Registry::add("type_late_child", [] (Type* type) {
+                type->parent(Registry::get("type_late_parent"));
+            });
+
+    const Type* child = Registry::get("type_late_child");
+    BOOST_CHECK(parent->isFinalized());
+    BOOST_CHECK(child->isFinalized());
+    BOOST_CHECK(!child->hasFunction("late"));
+    BOOST_CHECK(!child->hasField("lateField"));
+
+    parent->addFunction("late", Function("late", [] (int i) { return i; }));
+    parent->addField("lateField", Field("lateField", Argument::make<int>(), 0));
+
+    BOOST_CHECK(child->hasFunction("late"));
+    BOOST_CHECK_EQUAL(&child->function("late"), &parent->function("late"));
+    BOOST_CHECK(child->hasField("lateField"));
+    BOOST_CHECK_EQUAL(&child->field("lateField"), &parent->field("lateField"));
+}
+
+// Lookups on finalized types don't block on members being added to them.
+BOOST_AUTO_TEST_CASE(lateMembersConcurrent)
+{
+    Type* parent = nullptr;
+    Registry::add("type_concurrent_parent", [&] (Type* type) {
+                auto fn = [] (int i) { return i; };
+                type->addFunction("fn", Function("fn", fn));
+                parent = type;
+            });
+    Registry::add("type_concurrent_child", [] (Type* type) {
+                type->parent(Registry::get("type_concurrent_parent"));
+            });
+
+    const Type* child = Registry::get("type_concurrent_child");
+    const Overloads* fn = &parent->function("fn");
+
+    enum { Threads = 4, Members = 100 };
+
+    std::atomic<bool> done(false);
+    std::atomic<size_t> errors(0);
+    std::vector<std::thread> readers;
+
+    for (size_t i = 0; i < Threads; ++i) {
+        readers.emplace_back([&] {
+                    while (!done.load()) {
+                        if (&child->function("fn") != fn) errors++;
+                        if (!child->isChildOf(parent)) errors++;
+                    }
+                });
+    }
+
+    for (size_t i = 0; i < Members; ++i) {
+        auto late = [] (int i) { return i; };
+        std::string name = "late" + std::to_string(i);
+        parent->addFunction(name, Function(name, late));
+    }
+
+    done = true;
+    for (auto& reader : readers) reader.join();
+
+    BOOST_CHECK_EQUAL(errors.load(), 0u);
+    for (size_t i = 0; i < Members; ++i)
+        BOOST_CHECK(child->hasFunction("late" + std::to_string(i)));
+}
+
+// Children loaded while their parent is still loading are finalized once their
+// parent is.
+BOOST_AUTO_TEST_CASE(deferredFinalize)
+{
+    const Type* child = nullptr;
+    Registry::add("type_deferred_parent", [&] (Type* type) {
+                auto fn = [] (int i) { return i; };
+                type->addFunction("fn", Function("fn", fn));
+                child = Registry::get("type_deferred_child");
+                BOOST_CHECK(!child->isFinalized());
+            });
+    Registry::add("type_deferred_child", [] (Type* type) {
+                type->parent(Registry::get("type_deferred_parent"));
+            });
+
+    const Type* parent = Registry::get("type_deferred_parent");
+    BOOST_CHECK(parent->isFinalized());
+    BOOST_CHECK(child->isFinalized());
+    BOOST_CHECK(child->isChildOf(parent));
+    BOOST_CHECK(child->hasFunction("fn"));
+    BOOST_CHECK_EQUAL(&child->function("fn"), &parent->function("fn"));
 }
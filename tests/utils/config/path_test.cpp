@@ -9,7 +9,6 @@
 
 #define BOOST_TEST_MAIN
 #define BOOST_TEST_DYN_LINK
-#define REFLECT_USE_EXCEPTIONS 1
 
 #include "reflect.h"
 #include "dsl/type.h"
@@ -19,6 +18,7 @@
 #include "types/std/vector.h"
 #include "types/std/string.h"
 #include "utils/config/includes.h"
+#include "../../tests.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -51,10 +51,6 @@ struct B
     std::vector<A> v;
     std::map<std::string, A> m;
 
-    A& fr() const { return *p; }
-    A* fp() const { return p; }
-    void fp(A* a) { p = a; }
-
     B() : p(new A(400))
     {
         m["x"] = { 300 };
@@ -69,8 +65,23 @@ reflectType(B)
     reflectField(p);
     reflectField(v);
     reflectField(m);
-    reflectField(fp);
-    reflectField(fr);
+}
+
+struct C
+{
+    int i;
+    A a;
+    B b;
+
+    C() : i(0) {}
+};
+
+reflectType(C)
+{
+    reflectPlumbing();
+    reflectField(i);
+    reflectField(a);
+    reflectField(b);
 }
 
 
@@ -102,13 +113,6 @@ BOOST_AUTO_TEST_CASE(has)
     BOOST_CHECK( config::has(b, "p.p"));
     BOOST_CHECK(!config::has(b, "p.d"));
 
-    BOOST_CHECK( config::has(b, "fp"));
-    BOOST_CHECK( config::has(b, "fp.i"));
-    BOOST_CHECK(!config::has(b, "fp.j"));
-    BOOST_CHECK( config::has(b, "fr"));
-    BOOST_CHECK( config::has(b, "fr.i"));
-    BOOST_CHECK(!config::has(b, "fr.j"));
-
     BOOST_CHECK( config::has(b, "v"));
     BOOST_CHECK( config::has(b, "v.0"));
     BOOST_CHECK( config::has(b, "v.0.i"));
@@ -133,16 +137,11 @@ BOOST_AUTO_TEST_CASE(get)
 
 
     Value vB = type<B>()->construct();
-    B& b = vB.cast<B>();
+    B& b = vB.as<B>();
     BOOST_CHECK_EQUAL( config::get(vB, "p").get<A*>(), b.p);
     BOOST_CHECK_EQUAL( config::get(vB, "p.i").get<int>(), b.p->i);
     BOOST_CHECK_EQUAL( config::get(vB, "p.p").get<int*>(), b.p->p);
 
-    BOOST_CHECK_EQUAL( config::get(vB, "fp").get<A*>(), b.fp());
-    BOOST_CHECK_EQUAL( config::get(vB, "fp.i").get<int>(), b.fp()->i);
-    BOOST_CHECK_EQUAL(&config::get(vB, "fr").get<A>(), &b.fr());
-    BOOST_CHECK_EQUAL( config::get(vB, "fr.i").get<int>(), b.fr().i);
-
     typedef std::vector<A> Vec;
     BOOST_CHECK_EQUAL(&config::get(vB, "v").get<Vec>(), &b.v);
     BOOST_CHECK_EQUAL(&config::get(vB, "v.0").get<A>(), &b.v[0]);
@@ -171,7 +170,7 @@ BOOST_AUTO_TEST_CASE(set)
 
 
     Value vB = type<B>()->construct();
-    B& b = vB.cast<B>();
+    B& b = vB.as<B>();
 
     {
         A* p = new A;
@@ -189,17 +188,6 @@ BOOST_AUTO_TEST_CASE(set)
     }
 
     {
-        A* p = new A;
-        config::set(vB, "fp", p);
-        BOOST_CHECK_EQUAL(b.fp(), p);
-    }
-
-    config::set(vB, "fp.i", 15);
-    BOOST_CHECK_EQUAL(b.fp()->i, 15);
-
-    {
-        typedef std::vector<A> Vec;
-
         config::set(vB, "v.0", A(16));
         BOOST_CHECK_EQUAL(b.v[0].i, 16);
 
@@ -217,8 +205,6 @@ BOOST_AUTO_TEST_CASE(set)
     }
 
     {
-        typedef std::map<std::string, A> Map;
-
         config::set(vB, "m.x", A(21));
         BOOST_CHECK_EQUAL(b.m["x"].i, 21);
 
@@ -234,3 +220,94 @@ BOOST_AUTO_TEST_CASE(set)
 }
 
 
+BOOST_AUTO_TEST_CASE(compile)
+{
+    const Type* tB = type<B>();
+    Value vB = tB->construct();
+    B& b = vB.as<B>();
+
+    auto path = config::Path("p.i").compile(tB);
+    BOOST_CHECK_EQUAL(path.root(), tB);
+    BOOST_CHECK_EQUAL(path.target().type(), type<int>());
+    BOOST_CHECK_EQUAL(&path.get<int&>(vB), &b.p->i);
+
+    auto vec = config::Path("v.1.i").compile(tB);
+    BOOST_CHECK_EQUAL(&vec.get<int&>(vB), &b.v[1].i);
+
+    auto map = config::Path("m.x.i").compile(tB);
+    BOOST_CHECK_EQUAL(&map.get<int&>(vB), &b.m["x"].i);
+
+    CHECK_ERROR(config::Path("v.2").compile(tB).get(vB));
+    CHECK_ERROR(config::Path("v.x").compile(tB));
+    CHECK_ERROR(config::Path("d").compile(tB));
+
+    const Type* tA = type<A>();
+    Value vA = tA->construct();
+    CHECK_ERROR(path.get(vA));
+}
+
+BOOST_AUTO_TEST_CASE(compile_offsets)
+{
+    const Type* tC = type<C>();
+    Value vC = tC->construct();
+    C& c = vC.as<C>();
+
+    auto field = config::Path("a.i").compile(tC);
+    BOOST_CHECK_EQUAL(field.steps(), 1u);
+    BOOST_CHECK_EQUAL(&field.get<int&>(vC), &c.a.i);
+
+    // Offset of b.p, load of the pointer and offset of i.
+    auto pointer = config::Path("b.p.i").compile(tC);
+    BOOST_CHECK_EQUAL(pointer.steps(), 3u);
+    BOOST_CHECK_EQUAL(&pointer.get<int&>(vC), &c.b.p->i);
+
+    // Offset of b.v, call to operator[] and offset of i.
+    auto list = config::Path("b.v.1.i").compile(tC);
+    BOOST_CHECK_EQUAL(list.steps(), 3u);
+    BOOST_CHECK_EQUAL(&list.get<int&>(vC), &c.b.v[1].i);
+}
+
+BOOST_AUTO_TEST_CASE(compile_bounds)
+{
+    const Type* tB = type<B>();
+    Value vB = tB->construct();
+    B& b = vB.as<B>();
+
+    auto first = config::Path("v.0.i").compile(tB);
+    auto third = config::Path("v.2.i").compile(tB);
+
+    BOOST_CHECK_EQUAL(&first.get<int&>(vB), &b.v[0].i);
+    CHECK_ERROR(third.get(vB));
+    BOOST_CHECK_EQUAL(b.v.size(), 2u);
+
+    // Bounds are checked against the list at the time of the access.
+    b.v.emplace_back(300);
+    BOOST_CHECK_EQUAL(&third.get<int&>(vB), &b.v[2].i);
+    BOOST_CHECK_EQUAL(third.get<int>(vB), 300);
+
+    b.v.clear();
+    CHECK_ERROR(first.get(vB));
+}
+
+BOOST_AUTO_TEST_CASE(compile_keys)
+{
+    const Type* tB = type<B>();
+    Value vB = tB->construct();
+    B& b = vB.as<B>();
+
+    // The keys must outlive both the path and the string it was parsed from.
+    config::CompiledPath x, y;
+    {
+        std::string str("m.x.i");
+        x = config::Path(str).compile(tB);
+        str = "m.y.i";
+        y = config::Path(str).compile(tB);
+    }
+
+    BOOST_CHECK_EQUAL(&x.get<int&>(vB), &b.m["x"].i);
+    BOOST_CHECK_EQUAL(x.get<int>(vB), 300);
+
+    BOOST_CHECK(!b.m.count("y"));
+    y.get<int&>(vB) = 10;
+    BOOST_CHECK_EQUAL(b.m["y"].i, 10);
+}
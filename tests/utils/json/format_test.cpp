@@ -11,6 +11,10 @@
 #include "utils/json.h"
 
 #include <boost/test/unit_test.hpp>
+#include <random>
+#include <limits>
+#include <cmath>
+#include <cstring>
 
 using namespace reflect;
 using namespace reflect::json;
@@ -23,6 +27,7 @@ using namespace reflect::json;
 void format(Writer& writer, nullptr_t) { formatNull(writer); }
 void format(Writer& writer, bool value) { formatBool(writer, value); }
 void format(Writer& writer, int value) { formatInt(writer, value); }
+void format(Writer& writer, int64_t value) { formatInt(writer, value); }
 void format(Writer& writer, double value) { formatFloat(writer, value); }
 void format(Writer& writer, const char* value) { formatString(writer, value); }
 void format(Writer& writer, std::string value) { formatString(writer, value); }
@@ -82,9 +87,43 @@ BOOST_AUTO_TEST_CASE(test_basics)
     check(123e+10, "1.23e+12");
     check(1.23e10, "12300000000");
     check(0.123456789, "0.123456789");
-    check(0.123456789123456789, "0.123456789123");
+    check(0.123456789123456789, "0.12345678912345678");
     check(0.000000123456789, "1.23456789e-07");
-    check(0.000000123456789123456789, "1.23456789123e-07");
+    check(0.000000123456789123456789, "1.234567891234568e-07");
+
+    check(std::numeric_limits<int64_t>::max(), "9223372036854775807");
+    check(std::numeric_limits<int64_t>::min(), "-9223372036854775808");
+    check(0.0, "0");
+    check(-0.0, "-0");
+    check(1e100, "1e+100");
+    check(5e-324, "5e-324");
+    check(1.7976931348623157e308, "1.7976931348623157e+308");
+}
+
+BOOST_AUTO_TEST_CASE(test_float_round_trip)
+{
+    std::mt19937_64 rng;
+
+    for (size_t i = 0; i < 100000; ++i) {
+        uint64_t bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+
+        std::stringstream ss;
+        Writer writer(ss);
+        formatFloat(writer, value);
+
+        double result = 0;
+        std::string str = ss.str();
+        Reader reader(str);
+        parse(reader, result);
+
+        if (reader.error() || std::memcmp(&value, &result, sizeof(value))) {
+            BOOST_ERROR(str << " -> " << result << " "
+                    << reader.error().what());
+        }
+    }
 }
 
 BOOST_AUTO_TEST_CASE(test_string)
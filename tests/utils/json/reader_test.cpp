@@ -11,6 +11,11 @@
 #include "utils/json.h"
 
 #include <boost/test/unit_test.hpp>
+#include <random>
+#include <limits>
+#include <cmath>
+#include <cstring>
+#include <clocale>
 
 using namespace reflect;
 using namespace reflect::json;
@@ -20,23 +25,42 @@ using namespace reflect::json;
 /* UTILS                                                                      */
 /******************************************************************************/
 
-void checkToken(
-        const std::string& s, Token::Type type,
-        Reader::Options options = Reader::Default)
+// Runs fn against the stream reader and against the contiguous reader for
+// every scan mode supported by the CPU.
+template<typename Fn>
+void forEachReader(const std::string& s, Reader::Options options, const Fn& fn)
 {
     std::istringstream stream(s);
-    Reader reader(stream, options);
+    Reader streamReader(stream, options);
+    fn(streamReader);
 
-    Token token = reader.expectToken(type);
+    ScanMode best = detectScanMode();
+    for (ScanMode mode : { ScanMode::Scalar, ScanMode::SSE2, ScanMode::AVX2 }) {
+        if (!setScanMode(mode)) continue;
+
+        Reader bufferReader(s, options);
+        fn(bufferReader);
+    }
+    setScanMode(best);
+}
 
-    std::cerr << "<" << s << "> -> ";
-    if (!reader.error()) std::cerr << token.print();
-    else std::cerr << "<" << reader.error().what() << ">";
-    std::cerr << std::endl;
+void checkToken(
+        const std::string& s, Token::Type type,
+        Reader::Options options = Reader::Default)
+{
+    forEachReader(s, options, [&] (Reader& reader) {
+                Token token = reader.expectToken(type);
+
+                std::cerr << "<" << s << "> -> ";
+                if (!reader.error()) std::cerr << token.print();
+                else std::cerr << "<" << reader.error().what() << ">";
+                std::cerr << std::endl;
+            });
 }
 
 void check(Token token, bool exp) { BOOST_CHECK_EQUAL(token.asBool(), exp); }
 void check(Token token, int exp) { BOOST_CHECK_EQUAL(token.asInt(), exp); }
+void check(Token token, int64_t exp) { BOOST_CHECK_EQUAL(token.asInt(), exp); }
 void check(Token token, double exp) { BOOST_CHECK_CLOSE(token.asFloat(), exp, 0.0000001); }
 void check(Token token, const char* exp) { BOOST_CHECK_EQUAL(token.asString(), exp); }
 void check(Token token, std::string exp) { BOOST_CHECK_EQUAL(token.asString(), exp); }
@@ -46,33 +70,31 @@ void checkToken(
         const std::string& s, Token::Type type, T exp,
         Reader::Options options = Reader::Default)
 {
-    std::istringstream stream(s);
-    Reader reader(stream, options);
+    forEachReader(s, options, [&] (Reader& reader) {
+                Token token = reader.expectToken(type);
 
-    Token token = reader.expectToken(type);
+                std::cerr << "<" << s << "> -> ";
+                if (!reader.error()) std::cerr << token.print();
+                else std::cerr << "<" << reader.error().what() << ">";
+                std::cerr << std::endl;
 
-    std::cerr << "<" << s << "> -> ";
-    if (!reader.error()) std::cerr << token.print();
-    else std::cerr << "<" << reader.error().what() << ">";
-    std::cerr << std::endl;
-
-    BOOST_CHECK(!reader.error());
-    check(token, exp);
+                BOOST_CHECK(!reader.error());
+                check(token, exp);
+            });
 }
 
 void errorToken(const std::string& s, Reader::Options options = Reader::Default)
 {
-    std::istringstream stream(s);
-    Reader reader(stream, options);
-
-    Token token = reader.nextToken();
+    forEachReader(s, options, [&] (Reader& reader) {
+                Token token = reader.nextToken();
 
-    std::cerr << "<" << s << "> -> ";
-    if (!reader.error()) std::cerr << token.print();
-    else std::cerr << "expected<" << reader.error().what() << ">";
-    std::cerr << std::endl;
+                std::cerr << "<" << s << "> -> ";
+                if (!reader.error()) std::cerr << token.print();
+                else std::cerr << "expected<" << reader.error().what() << ">";
+                std::cerr << std::endl;
 
-    BOOST_CHECK(!!reader.error());
+                BOOST_CHECK(!!reader.error());
+            });
 }
 
 
@@ -125,7 +147,91 @@ BOOST_AUTO_TEST_CASE(test_number)
     checkToken("123.456e78", Token::Float, 123.456e78);
 
     errorToken(".1");
+    errorToken("-.1");
+    errorToken("-.");
     checkToken("1.1.1", Token::Float, 1.1);
+
+    const int64_t max = std::numeric_limits<int64_t>::max();
+    const int64_t min = std::numeric_limits<int64_t>::min();
+    checkToken("9223372036854775807", Token::Int, max);
+    checkToken("-9223372036854775808", Token::Int, min);
+    checkToken("-0", Token::Int, 0);
+    errorToken("9223372036854775808");
+    errorToken("-9223372036854775809");
+    errorToken("100000000000000000000");
+    errorToken("-");
+
+    checkToken("12345678901234567890123e-3", Token::Float,
+            12345678901234567890.123);
+    checkToken("0.000000000000000000000000123", Token::Float, 1.23e-25);
+}
+
+BOOST_AUTO_TEST_CASE(test_float_rounding)
+{
+    auto checkBits = [] (const std::string& s) {
+        double exp = std::strtod(s.c_str(), nullptr);
+
+        forEachReader(s, Reader::Default, [&] (Reader& reader) {
+                    double value = reader.expectToken(Token::Float).asFloat();
+                    if (std::memcmp(&value, &exp, sizeof(value))) {
+                        BOOST_ERROR("<" << s << "> -> " << value
+                                << " != " << exp);
+                    }
+                });
+    };
+
+    for (const char* s : {
+                "1e23", "9007199254740993e0", "9007199254740992.5",
+                "2.2250738585072014e-308", "2.2250738585072011e-308",
+                "4.9e-324", "1e-400", "-1e-400", "1.7976931348623157e308",
+                "1.7976931348623159e308", "1e400", "-0.0", "0.0e10",
+                "3.14159265358979323846264338327950288419716939937510",
+                "7.2057594037927933e16", "5e-324", "123456789012345678e-40",
+                "0.1", "0.2", "0.3", "1e22", "1e-22", "8.98846567431158e307" })
+    {
+        checkBits(s);
+    }
+
+    std::mt19937_64 rng;
+    char buffer[64];
+
+    for (size_t i = 0; i < 10000; ++i) {
+        uint64_t bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+
+        snprintf(buffer, sizeof(buffer), "%.*e", int(i % 17), value);
+        checkBits(buffer);
+    }
+
+    for (size_t i = 0; i < 10000; ++i) {
+        int exponent = int(rng() % 80) - 40;
+        snprintf(buffer, sizeof(buffer), "%llue%d",
+                (unsigned long long) (rng() >> (rng() % 64)), exponent);
+        checkBits(buffer);
+    }
+}
+
+// Numbers too long for the fast path go through strtod which must ignore the
+// decimal point of the current locale.
+BOOST_AUTO_TEST_CASE(test_float_locale)
+{
+    const char* locales[] = { "de_DE.UTF-8", "fr_FR.UTF-8", "ru_RU.UTF-8" };
+
+    const char* current = nullptr;
+    for (const char* name : locales) {
+        if ((current = std::setlocale(LC_NUMERIC, name))) break;
+    }
+
+    if (!current) {
+        BOOST_TEST_MESSAGE("no locale with a decimal comma available");
+        return;
+    }
+
+    checkToken("12345678901234567890123.5", Token::Float,
+            12345678901234567890123.5);
+    std::setlocale(LC_NUMERIC, "C");
 }
 
 BOOST_AUTO_TEST_CASE(test_string)
@@ -184,3 +290,63 @@ BOOST_AUTO_TEST_CASE(test_string)
     errorToken(s(u({ 0xE0, 0x8F })));
     errorToken(s(u({ 0xE0, 0x8F, 0x0F })));
 }
+
+BOOST_AUTO_TEST_CASE(position)
+{
+    const std::string s = "{\n  \"a\": 10,\n  \"b\": x }";
+
+    std::vector<std::string> errors;
+    forEachReader(s, Reader::Default, [&] (Reader& reader) {
+                while (reader) reader.nextToken();
+                errors.push_back(reader.error().what());
+            });
+
+    for (const auto& error : errors) BOOST_CHECK_EQUAL(error, errors[0]);
+    BOOST_CHECK_EQUAL(errors[0].substr(0, 5), "3:9: ");
+}
+
+BOOST_AUTO_TEST_CASE(scan)
+{
+    // Straddles the 16 and 32 bytes blocks of the vectorized scanners.
+    for (size_t n = 0; n < 80; ++n) {
+        std::string pad(n, ' ');
+        checkToken(pad + "\t\r\n,", Token::Separator);
+        checkToken(pad + "\v\f" + pad + "]", Token::ArrayEnd);
+        checkToken(pad + "// " + pad + "\n" + pad + ",", Token::Separator,
+                Reader::AllowComments);
+
+        std::string str(n, 'a');
+        std::string utf8 = "\xCF\x8F";
+        checkToken('"' + str + '"', Token::String, str);
+        checkToken('"' + str + "\\n" + str + '"', Token::String, str + "\n" + str);
+        checkToken('"' + str + utf8 + '"', Token::String, str + utf8);
+        checkToken('"' + str + "\xF0" + str + '"', Token::String,
+                str + "\xF0" + str, Reader::None);
+
+        errorToken('"' + str);
+        errorToken('"' + str + "\n" + str + '"');
+        errorToken('"' + str + "\xF0" + str + '"');
+    }
+}
+
+BOOST_AUTO_TEST_CASE(string_view)
+{
+    const std::string s = "\"abc\" \"\xCF\x8F\" \"a\\nc\"";
+    Reader reader(s);
+
+    Token token = reader.expectToken(Token::String);
+    BOOST_CHECK(token.data() == s.data() + 1);
+    BOOST_CHECK_EQUAL(token.asString(), "abc");
+
+    token = reader.expectToken(Token::String);
+    BOOST_CHECK(token.data() == s.data() + 7);
+    BOOST_CHECK_EQUAL(token.asString(), "\xCF\x8F");
+
+    token = reader.expectToken(Token::String);
+    BOOST_CHECK(token.data() == reader.buffer().data());
+    BOOST_CHECK_EQUAL(token.asString(), "a\nc");
+
+    std::string value;
+    token.assignString(value);
+    BOOST_CHECK_EQUAL(value, "a\nc");
+}
@@ -48,6 +48,20 @@ BOOST_AUTO_TEST_CASE(test_basics)
     BOOST_CHECK_EQUAL(obj, exp);
 }
 
+BOOST_AUTO_TEST_CASE(test_mapped_file)
+{
+    Basics exp;
+    Basics::construct(exp);
+
+    Basics obj;
+    auto err = json::parseFile("tests/utils/json/value_parser.json", obj);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(obj, exp);
+
+    Basics missing;
+    BOOST_CHECK(!!json::parseFile("tests/utils/json/missing.json", missing));
+}
+
 
 /******************************************************************************/
 /* TEST VALUE PARSER                                                          */
@@ -0,0 +1,110 @@
+/* value_ref_test.cpp                                 -*- C++ -*-
+   agent (agent@local), 18 Oct 2026
+   FreeBSD-style copyright and disclaimer apply
+
+   Tests for ValueRef.
+*/
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include "tests.h"
+#include "reflect.h"
+#include "test_types.h"
+#include "types/primitives.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace reflect;
+
+
+/******************************************************************************/
+/* TESTS                                                                      */
+/******************************************************************************/
+
+BOOST_AUTO_TEST_CASE(basics)
+{
+    static_assert(std::is_trivially_copyable<ValueRef>::value, "not trivial");
+    static_assert(sizeof(ValueRef) == 2 * sizeof(void*), "too big");
+
+    test::Object obj(10);
+    ValueRef ref(obj);
+
+    BOOST_CHECK_EQUAL(ref.type(), type<test::Object>());
+    BOOST_CHECK_EQUAL(ref.value(), &obj);
+    BOOST_CHECK_EQUAL(ref.refType(), RefType::LValue);
+    BOOST_CHECK(!ref.isConst());
+    BOOST_CHECK(!ref.isVoid());
+    BOOST_CHECK(ref.argument() == Argument::make<test::Object&>());
+    BOOST_CHECK_EQUAL(&ref.get<test::Object>(), &obj);
+
+    const test::Object& cobj = obj;
+    ValueRef cref(cobj);
+    BOOST_CHECK(cref.isConst());
+    BOOST_CHECK(ref.toConst().isConst());
+    BOOST_CHECK_EQUAL(cref.value(), &obj);
+
+    BOOST_CHECK_EQUAL(&ref.as<test::Object>(), &obj);
+    BOOST_CHECK_EQUAL(&cref.get<test::Object>(), &obj);
+    CHECK_ERROR(cref.as<test::Object>());
+    CHECK_ERROR(ref.get<test::Parent>());
+
+    BOOST_CHECK(ValueRef().isVoid());
+}
+
+BOOST_AUTO_TEST_CASE(value)
+{
+    test::Object obj(10);
+    Value value(obj);
+
+    ValueRef ref = value;
+    BOOST_CHECK_EQUAL(ref.value(), &obj);
+    BOOST_CHECK(ref.argument() == value.argument());
+
+    Value other = ref.toValue();
+    BOOST_CHECK_EQUAL(other.value(), &obj);
+    BOOST_CHECK(!other.isStored());
+
+    BOOST_CHECK_EQUAL(cast<ValueRef>(value).value(), &obj);
+    BOOST_CHECK_EQUAL(&cast<test::Object&>(ref), &obj);
+    BOOST_CHECK_EQUAL(cast<int>(ref.field("value")), 10);
+}
+
+BOOST_AUTO_TEST_CASE(call)
+{
+    test::Object obj(10);
+    ValueRef ref(obj);
+
+    ref.call<void>("operator+=", 1);
+    BOOST_CHECK_EQUAL(obj.value, 11);
+    BOOST_CHECK_EQUAL(&ref.call<int&>("ref"), &obj.value);
+
+    const auto& add = type<test::Object>()->function("operator+");
+    BOOST_CHECK_EQUAL(add.call<test::Object>(ref, 1).value, 12);
+
+    ref.assign(test::Object(20));
+    BOOST_CHECK_EQUAL(obj.value, 20);
+
+    const test::Object& cobj = obj;
+    CHECK_ERROR(ValueRef(cobj).call<void>("operator+=", 1));
+}
+
+BOOST_AUTO_TEST_CASE(field)
+{
+    test::Child child(test::Object(10), true);
+    ValueRef ref(child);
+
+    ValueRef value = ref.field("childValue");
+    BOOST_CHECK_EQUAL(value.type(), type<test::Object>());
+    BOOST_CHECK_EQUAL(value.value(), &child.childValue);
+    BOOST_CHECK_EQUAL(ref.field("shadowed").get<bool>(), true);
+    BOOST_CHECK_EQUAL(ref.field("shadowed", 8).value(), &child.shadowed);
+
+    value.field("value").assign(20);
+    BOOST_CHECK_EQUAL(child.childValue.value, 20);
+
+    const test::Child& cchild = child;
+    ValueRef cref(cchild);
+    BOOST_CHECK(cref.field("childValue").isConst());
+    CHECK_ERROR(cref.field("childValue").field("value").assign(30));
+}
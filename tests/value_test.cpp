@@ -231,6 +231,46 @@ BOOST_AUTO_TEST_CASE(convertible)
 }
 
 
+/******************************************************************************/
+/* STORAGE                                                                    */
+/******************************************************************************/
+
+// Inline objects are copied along with their Value while boxed objects are
+// shared by all the copies.
+BOOST_AUTO_TEST_CASE(copies)
+{
+    Value a(int(1));
+    Value b = a;
+    b.assign(2);
+    BOOST_CHECK_EQUAL(a.get<int>(), 1);
+    BOOST_CHECK_EQUAL(b.get<int>(), 2);
+
+    Value c(test::Object(1));
+    Value d = c;
+    d.assign(test::Object(2));
+    BOOST_CHECK_EQUAL(c.get<test::Object>().value, 2);
+    BOOST_CHECK_EQUAL(&c.get<test::Object>(), &d.get<test::Object>());
+}
+
+// Boxed objects don't move along with their Value.
+BOOST_AUTO_TEST_CASE(stability)
+{
+    std::vector<Value> values;
+    values.emplace_back(test::Object(0));
+    values.emplace_back(test::Object(1));
+
+    const test::Object* ptr = &values[0].get<test::Object>();
+    ValueRef ref(values[1]);
+
+    for (size_t i = 2; i < 100; ++i) values.emplace_back(test::Object(i));
+
+    BOOST_CHECK_EQUAL(ptr, &values[0].get<test::Object>());
+    BOOST_CHECK_EQUAL(ptr->value, 0);
+    BOOST_CHECK_EQUAL(ref.value(), values[1].value());
+    BOOST_CHECK_EQUAL(ref.get<test::Object>().value, 1);
+}
+
+
 /******************************************************************************/
 /* COMPILATION                                                                */
 /******************************************************************************/